@@ -0,0 +1,367 @@
+#ifndef ALTSHORTESTPATH_H_
+#define ALTSHORTESTPATH_H_
+
+#include <climits>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <CSRSearch.h>
+#include <GraphPath.h>
+#include <WeightedGraph.h>
+
+/**
+ * A* search with landmark based lower bounds (ALT: A*, landmarks and triangle
+ * inequality, see Goldberg and Harrelson, "Computing the shortest path: A*
+ * search meets graph theory", SODA 2005).
+ *
+ * <p>At construction time the exact distances from every landmark to all
+ * vertices, and for directed graphs also from all vertices to every landmark,
+ * are computed. The shortest path searches of the landmarks are independent
+ * and run in parallel when compiled with OpenMP. For a query from <code>
+ * v</code> to <code>t</code> the triangle inequality yields the lower
+ * bounds</p>
+ *
+ * <pre>
+ * d(v, t) &gt;= d(L, t) - d(L, v)
+ * d(v, t) &gt;= d(v, L) - d(t, L)
+ * </pre>
+ *
+ * <p>for every landmark <code>L</code>; the largest of them guides the A*
+ * search. The bounds are consistent, so every vertex is expanded at most
+ * once.</p>
+ *
+ * <p>The distance tables are stored vertex-major, <code>k</code> doubles per
+ * vertex, so an estimate reads two contiguous rows. The graph is taken as a
+ * {@link CSRGraph} snapshot at construction time. All edge weights must be
+ * non-negative.</p>
+ *
+ * @see AStarShortestPath
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class ALTShortestPath
+{
+public:
+	WeightedGraph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+	CSRSearch<V, E>* search;
+
+	int landmarkCount;
+	vector<int> landmarks;
+
+	/**
+	 * d(L_i, v) at index <code>v * landmarkCount + i</code>.
+	 */
+	vector<double> fromLandmark;
+
+	/**
+	 * d(v, L_i) at index <code>v * landmarkCount + i</code>; empty for
+	 * undirected graphs where it equals <code>fromLandmark</code>.
+	 */
+	vector<double> toLandmark;
+
+	/**
+	 * Creates a new ALT search, selecting the specified number of landmarks.
+	 * The landmarks are picked greedily, each one as far away (in hops) as
+	 * possible from the ones already chosen, so that every connected
+	 * component gets a landmark before any component gets a second one.
+	 *
+	 * @param graph the graph to be searched
+	 * @param count the number of landmarks
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or has
+	 * negative edge weights.
+	 */
+	ALTShortestPath(WeightedGraph<V, E>* graph, int count)
+	{
+		init(graph);
+		selectLandmarks(count);
+		preprocess();
+	}
+
+	/**
+	 * Creates a new ALT search with the specified landmarks.
+	 *
+	 * @param graph the graph to be searched
+	 * @param landmarkVertices the landmarks
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>, has
+	 * negative edge weights or a landmark is not found in the graph.
+	 */
+	ALTShortestPath(WeightedGraph<V, E>* graph, list<V*>* landmarkVertices)
+	{
+		init(graph);
+
+		typename list<V*>::iterator it;
+		for (it = landmarkVertices->begin(); it != landmarkVertices->end(); ++it) {
+			landmarks.push_back(indexOf(*it));
+		}
+		landmarkCount = landmarks.size();
+
+		preprocess();
+	}
+
+	virtual ~ALTShortestPath()
+	{
+		delete search;
+		delete csr;
+	}
+
+	/**
+	 * Calculates (and returns) the shortest path from the source vertex to
+	 * the target vertex.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return the shortest path, or <code>NULL</code> if no path exists.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	GraphPath<V, E>* getShortestPath(V* sourceVertex, V* targetVertex)
+	{
+		int t = indexOf(targetVertex);
+
+		if (!find(indexOf(sourceVertex), t)) {
+			return NULL;
+		}
+
+		return search->getPath(t);
+	}
+
+	/**
+	 * Returns the length of the shortest path from the source vertex to the
+	 * target vertex.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return the length of the path, or infinity if no path exists.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	double getPathLength(V* sourceVertex, V* targetVertex)
+	{
+		int t = indexOf(targetVertex);
+
+		if (!find(indexOf(sourceVertex), t)) {
+			return numeric_limits<double>::infinity();
+		}
+
+		return search->getDistance(t);
+	}
+
+	/**
+	 * Returns the landmark based lower bound of the distance between the
+	 * two vertices.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return lower bound of the distance
+	 */
+	double getCostEstimate(V* sourceVertex, V* targetVertex)
+	{
+		LandmarkHeuristic h(this);
+
+		return h(indexOf(sourceVertex), indexOf(targetVertex));
+	}
+
+	/**
+	 * Returns the landmarks in use.
+	 *
+	 * @return list of the landmark vertices
+	 */
+	list<V*>* getLandmarks()
+	{
+		list<V*>* result = new list<V*>();
+
+		for (int i = 0; i < landmarkCount; i++) {
+			result->push_back(csr->vertices[landmarks[i]]);
+		}
+
+		return result;
+	}
+
+	/**
+	 * Returns how many vertices were expanded by the last query.
+	 *
+	 * @return the number of expanded vertices
+	 */
+	int getNumberOfExpandedNodes()
+	{
+		return search->settledCount;
+	}
+
+private:
+	/**
+	 * The id level triangle inequality bound.
+	 */
+	class LandmarkHeuristic
+	{
+	public:
+		int k;
+		const double* from;
+		const double* to;
+
+		LandmarkHeuristic(ALTShortestPath<V, E>* alt)
+		{
+			k = alt->landmarkCount;
+			from = k > 0 ? &alt->fromLandmark[0] : NULL;
+			to = alt->toLandmark.empty() ? from : &alt->toLandmark[0];
+		}
+
+		double operator()(int vertex, int target) const
+		{
+			const double* fv = from + (long) vertex * k;
+			const double* ft = from + (long) target * k;
+			const double* tv = to + (long) vertex * k;
+			const double* tt = to + (long) target * k;
+			double best = 0.0;
+
+			// differences of two infinite entries are NaN and never win
+			for (int i = 0; i < k; i++) {
+				double forward = ft[i] - fv[i];
+				double backward = tv[i] - tt[i];
+
+				if (forward > best) {
+					best = forward;
+				}
+				if (backward > best) {
+					best = backward;
+				}
+			}
+
+			return best;
+		}
+	};
+
+	void init(WeightedGraph<V, E>* graph)
+	{
+		this->graph = graph;
+		csr = new CSRGraph<V, E>(graph, true);
+
+		if (csr->hasNegativeEdgeWeight()) {
+			delete csr;
+			throw new invalid_argument("ALT requires non-negative edge weights");
+		}
+
+		search = new CSRSearch<V, E>(csr);
+		landmarkCount = 0;
+	}
+
+	int indexOf(V* v)
+	{
+		int id = csr->indexOf(v);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return id;
+	}
+
+	bool find(int s, int t)
+	{
+		LandmarkHeuristic h(this);
+
+		return search->run(s, t, h);
+	}
+
+	/**
+	 * Farthest point selection on hop distances, ignoring edge directions.
+	 */
+	void selectLandmarks(int count)
+	{
+		int n = csr->vertexCount;
+		if (count > n) {
+			count = n;
+		}
+
+		vector<int> hops(n, INT_MAX);
+		vector<int> queue(n);
+		int next = 0;
+
+		for (int v = 1; v < n; v++) {
+			if (csr->outDegreeOf(v) + csr->inDegreeOf(v)
+				> csr->outDegreeOf(next) + csr->inDegreeOf(next))
+			{
+				next = v;
+			}
+		}
+
+		while ((int) landmarks.size() < count) {
+			landmarks.push_back(next);
+
+			int head = 0;
+			int tail = 0;
+			hops[next] = 0;
+			queue[tail++] = next;
+
+			while (head < tail) {
+				int v = queue[head++];
+
+				for (int dir = 0; dir < 2; dir++) {
+					const vector<int>& offsets = dir == 0 ? csr->outOffsets : csr->inOffsets;
+					const vector<int>& heads = dir == 0 ? csr->outTargets : csr->inSources;
+
+					for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+						int w = heads[a];
+						if (hops[w] > hops[v] + 1) {
+							hops[w] = hops[v] + 1;
+							queue[tail++] = w;
+						}
+					}
+				}
+			}
+
+			for (int v = 0; v < n; v++) {
+				if (hops[v] > hops[next]) {
+					next = v;
+				}
+			}
+		}
+
+		landmarkCount = landmarks.size();
+	}
+
+	/**
+	 * Fills the distance tables, one shortest path search per landmark and
+	 * direction.
+	 */
+	void preprocess()
+	{
+		int n = csr->vertexCount;
+		int k = landmarkCount;
+		int jobs = csr->directed ? 2 * k : k;
+
+		fromLandmark.assign((long) n * k, numeric_limits<double>::infinity());
+		if (csr->directed) {
+			toLandmark.assign((long) n * k, numeric_limits<double>::infinity());
+		}
+
+		#pragma omp parallel
+		{
+			CSRSearch<V, E> local(csr);
+
+			#pragma omp for schedule(dynamic, 1)
+			for (int job = 0; job < jobs; job++) {
+				int i = job % k;
+				bool backward = job >= k;
+				vector<double>& table = backward ? toLandmark : fromLandmark;
+
+				local.runAll(landmarks[i], backward);
+
+				for (int v = 0; v < n; v++) {
+					if (local.isReached(v)) {
+						table[(long) v * k + i] = local.distance[v];
+					}
+				}
+			}
+		}
+	}
+};
+
+#endif /* ALTSHORTESTPATH_H_ */
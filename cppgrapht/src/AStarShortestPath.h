@@ -0,0 +1,170 @@
+#ifndef ASTARSHORTESTPATH_H_
+#define ASTARSHORTESTPATH_H_
+
+#include <limits>
+#include <stdexcept>
+#include <CSRGraph.h>
+#include <CSRSearch.h>
+#include <GraphPath.h>
+#include <WeightedGraph.h>
+
+/**
+ * An implementation of <a
+ * href="http://en.wikipedia.org/wiki/A*_search_algorithm">A* shortest path
+ * algorithm</a>. The heuristic is a template parameter, so its estimate is
+ * inlined into the search instead of being dispatched virtually. A heuristic
+ * <code>H</code> provides
+ *
+ * <pre>
+ * double getCostEstimate(V* sourceVertex, V* targetVertex);
+ * </pre>
+ *
+ * returning an admissible estimate, i.e. a lower bound, of the distance from
+ * <code>sourceVertex</code> to <code>targetVertex</code>. The estimate is
+ * requested once per vertex and query. For landmark based estimates which are
+ * computed automatically see {@link ALTShortestPath}.
+ *
+ * <p>The graph is taken as a {@link CSRGraph} snapshot at construction time,
+ * so all following queries are answered on flat arrays; changes to the graph
+ * made afterwards are not seen. All edge weights must be non-negative.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E, class H>
+class AStarShortestPath
+{
+public:
+	WeightedGraph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+	CSRSearch<V, E>* search;
+	H heuristic;
+
+	/**
+	 * Creates a new A* search over the specified graph.
+	 *
+	 * @param graph the graph to be searched
+	 * @param heuristic admissible heuristic which estimates the distance
+	 * between two vertices
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or has
+	 * negative edge weights.
+	 */
+	AStarShortestPath(WeightedGraph<V, E>* graph, H heuristic)
+		: heuristic(heuristic)
+	{
+		this->graph = graph;
+		csr = new CSRGraph<V, E>(graph);
+
+		if (csr->hasNegativeEdgeWeight()) {
+			delete csr;
+			throw new invalid_argument("A* requires non-negative edge weights");
+		}
+
+		search = new CSRSearch<V, E>(csr);
+	}
+
+	virtual ~AStarShortestPath()
+	{
+		delete search;
+		delete csr;
+	}
+
+	/**
+	 * Calculates (and returns) the shortest path from the source vertex to
+	 * the target vertex.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return the shortest path, or <code>NULL</code> if no path exists.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	GraphPath<V, E>* getShortestPath(V* sourceVertex, V* targetVertex)
+	{
+		int t = indexOf(targetVertex);
+
+		if (!find(indexOf(sourceVertex), t)) {
+			return NULL;
+		}
+
+		return search->getPath(t);
+	}
+
+	/**
+	 * Returns the length of the shortest path from the source vertex to the
+	 * target vertex.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return the length of the path, or infinity if no path exists.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	double getPathLength(V* sourceVertex, V* targetVertex)
+	{
+		int t = indexOf(targetVertex);
+
+		if (!find(indexOf(sourceVertex), t)) {
+			return numeric_limits<double>::infinity();
+		}
+
+		return search->getDistance(t);
+	}
+
+	/**
+	 * Returns how many vertices were expanded by the last query.
+	 *
+	 * @return the number of expanded vertices
+	 */
+	int getNumberOfExpandedNodes()
+	{
+		return search->settledCount;
+	}
+
+private:
+	/**
+	 * Adapts the vertex level heuristic to the id level interface of {@link
+	 * CSRSearch}.
+	 */
+	class IdHeuristic
+	{
+	public:
+		H* heuristic;
+		vector<V*>* vertices;
+
+		IdHeuristic(H* heuristic, vector<V*>* vertices)
+		{
+			this->heuristic = heuristic;
+			this->vertices = vertices;
+		}
+
+		double operator()(int vertex, int target)
+		{
+			return heuristic->getCostEstimate(
+				(*vertices)[vertex],
+				(*vertices)[target]);
+		}
+	};
+
+	int indexOf(V* v)
+	{
+		int id = csr->indexOf(v);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return id;
+	}
+
+	bool find(int s, int t)
+	{
+		IdHeuristic h(&heuristic, &csr->vertices);
+
+		return search->run(s, t, h);
+	}
+};
+
+#endif /* ASTARSHORTESTPATH_H_ */
@@ -1,11 +1,14 @@
 #ifndef ABSTRACTBASEGRAPH_H_
 #define ABSTRACTBASEGRAPH_H_
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <stdexcept>
 #include <typeinfo>
+#include <vector>
 #include <AbstractGraph.h>
+#include <ConnectivityTracker.h>
 #include <EdgeFactory.h>
 #include <EdgeSetFactory.h>
 #include <Graphs.h>
@@ -36,6 +39,12 @@ public:
 	set<V*>* unmodifiableVertexSet;
 	bool allowingMultipleEdges;
 
+	/**
+	 * Connected components maintained on insertion, or <code>NULL</code> if
+	 * connectivity tracking is disabled.
+	 */
+	ConnectivityTracker<V>* connectivityTracker;
+
 	/**
      * .
      */
@@ -50,6 +59,8 @@ public:
 		}
 
         virtual void addVertex(V* vertex) = 0;
+        virtual bool containsVertex(V* vertex) = 0;
+        virtual void removeVertex(V* vertex) = 0;
         virtual set<V*>* getVertexSet() = 0;
 
         /**
@@ -170,6 +181,12 @@ public:
 		const set<EE*>* unmodifiableIncoming;
 		const set<EE*>* unmodifiableOutgoing;
 
+		/**
+		 * Union of the incoming and outgoing edges, built on first use and
+		 * kept up to date from then on, or <code>NULL</code>.
+		 */
+		set<EE*>* incomingAndOutgoing;
+
 		DirectedEdgeContainer(EdgeSetFactory<VV, EE>* edgeSetFactory,
 			VV* vertex)
 		{
@@ -177,6 +194,14 @@ public:
 			outgoing = edgeSetFactory->createEdgeSet(vertex);
 			unmodifiableIncoming = NULL;
 			unmodifiableOutgoing = NULL;
+			incomingAndOutgoing = NULL;
+		}
+
+		virtual ~DirectedEdgeContainer()
+		{
+			delete incoming;
+			delete outgoing;
+			delete incomingAndOutgoing;
 		}
 
 		/**
@@ -207,6 +232,22 @@ public:
 			return unmodifiableOutgoing;
 		}
 
+		/**
+		 * A lazy build of the union of the incoming and outgoing edges, in
+		 * which a self-loop appears once.
+		 *
+		 * @return
+		 */
+		const set<EE*>* getUnmodifiableIncomingAndOutgoingEdges()
+		{
+			if (incomingAndOutgoing == NULL) {
+				incomingAndOutgoing = new set<EE*>(incoming->begin(), incoming->end());
+				incomingAndOutgoing->insert(outgoing->begin(), outgoing->end());
+			}
+
+			return incomingAndOutgoing;
+		}
+
 		/**
 		 * .
 		 *
@@ -215,6 +256,10 @@ public:
 		void addIncomingEdge(EE* e)
 		{
 			incoming->insert(e);
+
+			if (incomingAndOutgoing != NULL) {
+				incomingAndOutgoing->insert(e);
+			}
 		}
 
 		/**
@@ -225,6 +270,10 @@ public:
 		void addOutgoingEdge(EE* e)
 		{
 			outgoing->insert(e);
+
+			if (incomingAndOutgoing != NULL) {
+				incomingAndOutgoing->insert(e);
+			}
 		}
 
 		/**
@@ -235,6 +284,10 @@ public:
 		void removeIncomingEdge(EE* e)
 		{
 			incoming->erase(e);
+
+			if (incomingAndOutgoing != NULL && outgoing->count(e) == 0) {
+				incomingAndOutgoing->erase(e);
+			}
 		}
 
 		/**
@@ -245,6 +298,10 @@ public:
 		void removeOutgoingEdge(EE* e)
 		{
 			outgoing->erase(e);
+
+			if (incomingAndOutgoing != NULL && incoming->count(e) == 0) {
+				incomingAndOutgoing->erase(e);
+			}
 		}
 	};
 
@@ -267,6 +324,21 @@ public:
 			vertexMapDirected->insert(pair<V*, DirectedEdgeContainer<V, E>* >(v, NULL));
 		}
 
+		bool containsVertex(V* v)
+		{
+			return vertexMapDirected->count(v) == 1;
+		}
+
+		void removeVertex(V* v)
+		{
+			typename map<V*, DirectedEdgeContainer<V, E>* >::iterator it = vertexMapDirected->find(v);
+
+			if (it != vertexMapDirected->end()) {
+				delete it->second;
+				vertexMapDirected->erase(it);
+			}
+		}
+
 		set<V*>* getVertexSet()
 		{
 			set<V*>* vset = new set<V*>();
@@ -352,31 +424,7 @@ public:
 		 */
 		set<E*>* edgesOf(V* vertex)
 		{
-			set<E*>* inAndOut = getEdgeContainer(vertex)->incoming;
-
-			typename set<E*>::iterator iter;
-			for (iter = getEdgeContainer(vertex)->outgoing->begin(); iter != getEdgeContainer(vertex)->outgoing->end(); ++iter) {
-				inAndOut->insert(*iter);
-			}
-
-			// we have two copies for each self-loop - remove one of them.
-			if (this->abg->allowingLoops) {
-				set<E*>* loops = getAllEdges(vertex, vertex);
-
-				typename set<E*>::iterator iter2;
-				for (iter2 = inAndOut->begin(); iter2 != inAndOut->end(); iter2++) {
-				//for (unsigned int i = 0; i < inAndOut->size();) {
-					//E* e = inAndOut->find(i);
-					E* e = *iter2;
-
-					if (loops->count(e) > 0) {
-						inAndOut->erase(iter2);
-						loops->erase(e); // so we remove it only once
-					}
-				}
-			}
-
-			return inAndOut;
+			return (set<E*>*)getEdgeContainer(vertex)->getUnmodifiableIncomingAndOutgoingEdges();
 		}
 
 		/**
@@ -440,7 +488,7 @@ public:
 				ec = new DirectedEdgeContainer<V, E>(
 					this->abg->edgeSetFactory,
 					vertex);
-				vertexMapDirected->insert(pair<V*, DirectedEdgeContainer<V, E>* >(vertex, ec));
+				(*vertexMapDirected)[vertex] = ec;
 			}
 
 			return ec;
@@ -465,6 +513,11 @@ public:
 			unmodifiableVertexEdges = NULL;
 		}
 
+		virtual ~UndirectedEdgeContainer()
+		{
+			delete vertexEdges;
+		}
+
 		/**
 		 * A lazy build of unmodifiable list of vertex edges
 		 *
@@ -529,6 +582,21 @@ public:
 			vertexMapUndirected->insert(pair<V*, UndirectedEdgeContainer<V, E>* >(v, NULL));
 		}
 
+		bool containsVertex(V* v)
+		{
+			return vertexMapUndirected->count(v) == 1;
+		}
+
+		void removeVertex(V* v)
+		{
+			typename map<V*, UndirectedEdgeContainer<V, E>* >::iterator it = vertexMapUndirected->find(v);
+
+			if (it != vertexMapUndirected->end()) {
+				delete it->second;
+				vertexMapUndirected->erase(it);
+			}
+		}
+
 		set<V*>* getVertexSet()
 		{
 			set<V*>* vset = new set<V*>();
@@ -650,6 +718,61 @@ public:
 			return (set<E*>*)getEdgeContainer(vertex)->getUnmodifiableVertexEdges();
 		}
 
+		/**
+		 * Converts the edge sets of all vertices into sorted adjacency arrays.
+		 * The vertices are numbered in the order of the vertex map, which is
+		 * the order of the vertex set, and the distinct neighbours of the
+		 * vertex with id <code>v</code> are written in ascending order of id
+		 * to the range <code>[offsets[v], offsets[v + 1])</code> of <code>
+		 * neighbors</code>. Parallel edges count once and self-loops not at
+		 * all.
+		 *
+		 * @param vertices receives the vertices by id
+		 * @param offsets receives the <code>n + 1</code> row bounds
+		 * @param neighbors receives the neighbour ids
+		 */
+		void getSortedAdjacency(vector<V*>& vertices, vector<int>& offsets, vector<int>& neighbors)
+		{
+			vertices.clear();
+			vertices.reserve(vertexMapUndirected->size());
+
+			typename map<V*, UndirectedEdgeContainer<V, E>* >::iterator iter;
+			for (iter = vertexMapUndirected->begin(); iter != vertexMapUndirected->end(); ++iter) {
+				vertices.push_back(iter->first);
+			}
+
+			offsets.assign(1, 0);
+			neighbors.clear();
+
+			// the map orders the vertices by address, so their ids are found
+			// by binary search
+			for (iter = vertexMapUndirected->begin(); iter != vertexMapUndirected->end(); ++iter) {
+				V* vertex = iter->first;
+				int start = neighbors.size();
+
+				if (iter->second != NULL) {
+					set<E*>* edges = iter->second->vertexEdges;
+
+					typename set<E*>::iterator eit;
+					for (eit = edges->begin(); eit != edges->end(); ++eit) {
+						V* opposite = this->abg->getEdgeSource(*eit);
+
+						if (opposite == vertex) {
+							opposite = this->abg->getEdgeTarget(*eit);
+						}
+						if (opposite != vertex) {
+							neighbors.push_back(
+								lower_bound(vertices.begin(), vertices.end(), opposite) - vertices.begin());
+						}
+					}
+				}
+
+				sort(neighbors.begin() + start, neighbors.end());
+				neighbors.erase(unique(neighbors.begin() + start, neighbors.end()), neighbors.end());
+				offsets.push_back(neighbors.size());
+			}
+		}
+
 		/**
 		 * @see DirectedGraph#inDegreeOf(Object)
 		 */
@@ -714,7 +837,7 @@ public:
 				ec = new UndirectedEdgeContainer<V, E>(
 					this->abg->edgeSetFactory,
 					vertex);
-				vertexMapUndirected->insert(pair<V*, UndirectedEdgeContainer<V, E>* >(vertex, ec));
+				(*vertexMapUndirected)[vertex] = ec;
 			}
 
 			return ec;
@@ -754,6 +877,7 @@ public:
 
 		unmodifiableEdgeSet = NULL;
 		unmodifiableVertexSet = NULL;
+		connectivityTracker = NULL;
 
 		//specifics = createSpecifics();
 		if (directed) {
@@ -765,6 +889,13 @@ public:
 		this->edgeSetFactory = new ArrayListFactory<V, E>();
 	}
 
+	virtual ~AbstractBaseGraph()
+	{
+		delete connectivityTracker;
+		delete unmodifiableVertexSet;
+		delete unmodifiableEdgeSet;
+	}
+
 	/**
 	 * @see Graph#getAllEdges(Object, Object)
 	 */
@@ -855,6 +986,14 @@ public:
 			edgeMap->insert(pair<E*, IntrusiveEdge<V>* >(e, intrusiveEdge));
 			specifics->addEdgeToTouchingVertices(e);
 
+			if (unmodifiableEdgeSet != NULL) {
+				unmodifiableEdgeSet->insert(e);
+			}
+
+			if (connectivityTracker != NULL) {
+				connectivityTracker->addEdge(sourceVertex, targetVertex);
+			}
+
 			return e;
 		}
 	}
@@ -889,6 +1028,14 @@ public:
 		edgeMap->insert(pair<E*, IntrusiveEdge<V>* >(e, intrusiveEdge));
 		specifics->addEdgeToTouchingVertices(e);
 
+		if (unmodifiableEdgeSet != NULL) {
+			unmodifiableEdgeSet->insert(e);
+		}
+
+		if (connectivityTracker != NULL) {
+			connectivityTracker->addEdge(sourceVertex, targetVertex);
+		}
+
 		return true;
 	}
 
@@ -920,6 +1067,14 @@ public:
 		} else {
 			specifics->addVertex(v);
 
+			if (unmodifiableVertexSet != NULL) {
+				unmodifiableVertexSet->insert(v);
+			}
+
+			if (connectivityTracker != NULL) {
+				connectivityTracker->addVertex(v);
+			}
+
 			return true;
 }
 	}
@@ -964,6 +1119,7 @@ public:
 		this->edgeFactory = source->edgeFactory;
 		this->unmodifiableEdgeSet = NULL;
 		this->unmodifiableVertexSet = NULL;
+		this->connectivityTracker = NULL;
 
 		// NOTE:  it's important for this to happen in an object
 		// method so that the new inner class instance gets associated with
@@ -988,7 +1144,7 @@ public:
 	 */
 	bool containsVertex(V* v)
 	{
-		return specifics->getVertexSet()->count(v) == 1;
+		return specifics->containsVertex(v);
 	}
 
 	/**
@@ -1001,6 +1157,9 @@ public:
 
 	/**
 	 * @see Graph#edgeSet()
+	 *
+	 * The set is built on first use and kept up to date by {@link #addEdge}
+	 * and {@link #removeEdge}.
 	 */
 	const set<E*>* edgeSet()
 	{
@@ -1009,11 +1168,9 @@ public:
 
 			typename map<E*, IntrusiveEdge<V>* >::iterator iter;
 			for (iter = edgeMap->begin(); iter != edgeMap->end(); ++iter) {
-				eset->insert((E*)iter->second);
+				eset->insert(iter->first);
 			}
 
-			return eset;
-
 			unmodifiableEdgeSet = eset;
 		}
 
@@ -1070,6 +1227,14 @@ public:
 		if (e != NULL) {
 			specifics->removeEdgeFromTouchingVertices(e);
 			edgeMap->erase(e);
+
+			if (unmodifiableEdgeSet != NULL) {
+				unmodifiableEdgeSet->erase(e);
+			}
+
+			if (connectivityTracker != NULL) {
+				connectivityTracker->invalidate();
+			}
 		}
 
 		return e;
@@ -1084,6 +1249,14 @@ public:
 			specifics->removeEdgeFromTouchingVertices(e);
 			edgeMap->erase(e);
 
+			if (unmodifiableEdgeSet != NULL) {
+				unmodifiableEdgeSet->erase(e);
+			}
+
+			if (connectivityTracker != NULL) {
+				connectivityTracker->invalidate();
+			}
+
 			return true;
 		} else {
 			return false;
@@ -1096,10 +1269,19 @@ public:
 	bool removeVertex(V* v)
 	{
 		if (containsVertex(v)) {
-			set<E*>* touchingEdgesList = edgesOf(v);
-			removeAllEdges(touchingEdgesList);
+			// a copy, as removing the edges changes the set they come from
+			set<E*> touchingEdges(*edgesOf(v));
+			removeAllEdges(&touchingEdges);
+
+			specifics->removeVertex(v); // remove the vertex itself
+
+			if (unmodifiableVertexSet != NULL) {
+				unmodifiableVertexSet->erase(v);
+			}
 
-			specifics->getVertexSet()->erase(v); // remove the vertex itself
+			if (connectivityTracker != NULL) {
+				connectivityTracker->invalidate();
+			}
 
 			return true;
 		} else {
@@ -1109,6 +1291,9 @@ public:
 
 	/**
 	 * @see Graph#vertexSet()
+	 *
+	 * The set is built on first use and kept up to date by {@link
+	 * #addVertex} and {@link #removeVertex}.
 	 */
 	const set<V*>* vertexSet()
 	{
@@ -1136,10 +1321,102 @@ public:
 	 */
 	void setEdgeWeight(E* e, double weight)
 	{
-		if (typeid(e) != typeid(DefaultWeightedEdge<V>)) {
+		if (typeid(e) != typeid(DefaultWeightedEdge<V>*)) {
 			throw new invalid_argument("Given edge is not a valid DefaultWeightedEdge");
 		}
-		((DefaultWeightedEdge<V>) e)->weight = weight;
+		((DefaultWeightedEdge<V>*) e)->weight = weight;
+	}
+
+	/**
+	 * Enables or disables connectivity tracking. While enabled, the connected
+	 * components (ignoring edge directions) are maintained on every insertion
+	 * by a {@link ConnectivityTracker}, so {@link #connected} and {@link
+	 * #componentOf} answer in nearly constant time. A removal makes the
+	 * tracker stale; it is rebuilt from the whole graph by the next query.
+	 *
+	 * @param enabled whether to track connectivity
+	 */
+	void setConnectivityTracking(bool enabled)
+	{
+		if (!enabled) {
+			delete connectivityTracker;
+			connectivityTracker = NULL;
+		} else if (connectivityTracker == NULL) {
+			connectivityTracker = new ConnectivityTracker<V>();
+			connectivityTracker->invalidate();
+		}
+	}
+
+	/**
+	 * Returns whether connectivity tracking is enabled.
+	 *
+	 * @return <code>true</code> if connectivity is tracked.
+	 */
+	bool isConnectivityTracking()
+	{
+		return connectivityTracker != NULL;
+	}
+
+	/**
+	 * Returns whether there is a path between two vertices, ignoring the
+	 * direction of the edges.
+	 *
+	 * @param sourceVertex one end of the path
+	 * @param targetVertex other end of the path
+	 *
+	 * @return <code>true</code> if the vertices are connected.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 * @throws logic_error if connectivity tracking is disabled.
+	 */
+	bool connected(V* sourceVertex, V* targetVertex)
+	{
+		return getConnectivityTracker()->connected(sourceVertex, targetVertex);
+	}
+
+	/**
+	 * Returns a representative vertex of the connected component of the
+	 * specified vertex. Vertices are connected if and only if they have the
+	 * same representative; it changes when components merge.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the representative of the component
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 * @throws logic_error if connectivity tracking is disabled.
+	 */
+	V* componentOf(V* vertex)
+	{
+		return getConnectivityTracker()->componentOf(vertex);
+	}
+
+	/**
+	 * Returns the tracker, rebuilt first if a removal made it stale.
+	 */
+	ConnectivityTracker<V>* getConnectivityTracker()
+	{
+		if (connectivityTracker == NULL) {
+			throw new logic_error("Connectivity tracking is disabled");
+		}
+
+		if (connectivityTracker->stale) {
+			connectivityTracker->clear();
+
+			set<V*>* vertices = specifics->getVertexSet();
+			typename set<V*>::iterator vit;
+			for (vit = vertices->begin(); vit != vertices->end(); ++vit) {
+				connectivityTracker->addVertex(*vit);
+			}
+			delete vertices;
+
+			typename map<E*, IntrusiveEdge<V>* >::iterator eit;
+			for (eit = edgeMap->begin(); eit != edgeMap->end(); ++eit) {
+				connectivityTracker->addEdge(eit->second->source, eit->second->target);
+			}
+		}
+
+		return connectivityTracker;
 	}
 
 //	Specifics* createSpecifics()
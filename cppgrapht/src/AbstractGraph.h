@@ -22,7 +22,7 @@
  * @see UndirectedGraph
  */
 template <class V, class E>
-class AbstractGraph : public Graph<V, E>
+class AbstractGraph : public virtual Graph<V, E>
 {
 public:
 	/**
@@ -0,0 +1,365 @@
+#ifndef BELLMANFORDSHORTESTPATH_H_
+#define BELLMANFORDSHORTESTPATH_H_
+
+#include <deque>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <GraphPath.h>
+#include <GraphPathImpl.h>
+#include <WeightedGraph.h>
+
+/**
+ * Bellman-Ford algorithm: weighted graphs, negative weights, single source.
+ * Computes the shortest paths from the start vertex to all other vertices or
+ * finds a negative-weight cycle reachable from it.
+ *
+ * <p>Two strategies are available:</p>
+ *
+ * <ul>
+ * <li>the queue based variant (SPFA), which only rescans vertices whose
+ * distance decreased;</li>
+ * <li>a parallel variant which performs full rounds over the incoming arcs of
+ * the {@link CSRGraph} snapshot. Every vertex pulls the best offer of its
+ * predecessors from the distances of the previous round, so the vertices of a
+ * round are relaxed in parallel (with OpenMP) without any write
+ * conflicts.</li>
+ * </ul>
+ *
+ * <p>Without a start vertex the distances are measured from a virtual vertex
+ * with zero-weight edges to every vertex. These distances form a feasible
+ * potential as used by Johnson's reweighting, see {@link
+ * JohnsonShortestPaths}.</p>
+ *
+ * <p>Both variants look for a cycle in the graph of predecessor edges every
+ * <code>n</code> relaxations respectively after every round. Such a cycle is
+ * a negative cycle, which usually shows up long before the <code>n</code>
+ * rounds of the textbook algorithm are over. It is returned as a closed
+ * {@link GraphPath} by {@link #getNegativeCycle}.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class BellmanFordShortestPath
+{
+public:
+	WeightedGraph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+	int source;
+
+	vector<double> distance;
+	vector<int> predecessor;
+	vector<int> predecessorEdge;
+
+	/**
+	 * Edge ids of the negative cycle found, in traversal order; empty if
+	 * there is none.
+	 */
+	vector<int> cycle;
+
+	/**
+	 * Computes the shortest paths from the specified start vertex.
+	 *
+	 * @param graph the graph to be searched
+	 * @param startVertex the vertex at which the paths start, or <code>
+	 * NULL</code> for the virtual vertex adjacent to all vertices
+	 * @param parallel whether to use the parallel round based variant instead
+	 * of the queue based one
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or the start
+	 * vertex is not found in the graph.
+	 */
+	BellmanFordShortestPath(
+		WeightedGraph<V, E>* graph,
+		V* startVertex,
+		bool parallel = false)
+	{
+		this->graph = graph;
+		csr = new CSRGraph<V, E>(graph, parallel);
+		source = startVertex == NULL ? -1 : csr->indexOf(startVertex);
+
+		if (startVertex != NULL && source < 0) {
+			delete csr;
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		int n = csr->vertexCount;
+		distance.assign(n, source < 0 ? 0.0 : numeric_limits<double>::infinity());
+		predecessor.assign(n, -1);
+		predecessorEdge.assign(n, -1);
+		if (source >= 0) {
+			distance[source] = 0.0;
+		}
+
+		if (parallel) {
+			runRounds();
+		} else {
+			runQueue();
+		}
+	}
+
+	virtual ~BellmanFordShortestPath()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Returns whether a negative-weight cycle is reachable from the start
+	 * vertex. In that case no shortest paths exist.
+	 *
+	 * @return <code>true</code> if a negative cycle was found.
+	 */
+	bool hasNegativeCycle()
+	{
+		return !cycle.empty();
+	}
+
+	/**
+	 * Returns a negative-weight cycle reachable from the start vertex as a
+	 * closed path.
+	 *
+	 * @return the cycle, or <code>NULL</code> if there is none.
+	 */
+	GraphPath<V, E>* getNegativeCycle()
+	{
+		if (cycle.empty()) {
+			return NULL;
+		}
+
+		list<E*>* edgeList = new list<E*>();
+		double weight = 0.0;
+
+		for (int i = 0; i < (int) cycle.size(); i++) {
+			edgeList->push_back(csr->edges[cycle[i]]);
+			weight += csr->edgeWeights[cycle[i]];
+		}
+
+		V* start = csr->vertices[csr->edgeSources[cycle[0]]];
+
+		return new GraphPathImpl<V, E>(graph, start, start, edgeList, weight);
+	}
+
+	/**
+	 * Returns the cost of the shortest path from the start vertex to the
+	 * specified end vertex.
+	 *
+	 * @param endVertex the end vertex
+	 *
+	 * @return the cost, or infinity if the vertex is unreachable.
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 * @throws logic_error if a negative cycle was found.
+	 */
+	double getCost(V* endVertex)
+	{
+		return distance[indexOf(endVertex)];
+	}
+
+	/**
+	 * Returns the shortest path from the start vertex to the specified end
+	 * vertex.
+	 *
+	 * @param endVertex the end vertex
+	 *
+	 * @return the path, or <code>NULL</code> if the vertex is unreachable.
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 * @throws logic_error if a negative cycle was found.
+	 */
+	GraphPath<V, E>* getPath(V* endVertex)
+	{
+		int t = indexOf(endVertex);
+
+		if (distance[t] == numeric_limits<double>::infinity()) {
+			return NULL;
+		}
+
+		list<E*>* edgeList = new list<E*>();
+		int v = t;
+		for (; predecessor[v] >= 0; v = predecessor[v]) {
+			edgeList->push_front(csr->edges[predecessorEdge[v]]);
+		}
+
+		return new GraphPathImpl<V, E>(
+			graph, csr->vertices[v], endVertex, edgeList, distance[t]);
+	}
+
+	/**
+	 * Returns the edges of the shortest path from the start vertex to the
+	 * specified end vertex.
+	 *
+	 * @param endVertex the end vertex
+	 *
+	 * @return list of edges, or <code>NULL</code> if the vertex is
+	 * unreachable.
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 * @throws logic_error if a negative cycle was found.
+	 */
+	list<E*>* getPathEdgeList(V* endVertex)
+	{
+		GraphPath<V, E>* path = getPath(endVertex);
+
+		if (path == NULL) {
+			return NULL;
+		}
+
+		list<E*>* edgeList = new list<E*>(*path->getEdgeList());
+		delete path;
+
+		return edgeList;
+	}
+
+private:
+	int indexOf(V* v)
+	{
+		int id = csr->indexOf(v);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+		if (!cycle.empty()) {
+			throw new logic_error("Graph contains a negative-weight cycle");
+		}
+
+		return id;
+	}
+
+	/**
+	 * The queue based variant (SPFA).
+	 */
+	void runQueue()
+	{
+		int n = csr->vertexCount;
+		vector<bool> queued(n, false);
+		vector<int> length(n, 0);
+		deque<int> queue;
+		long relaxations = 0;
+
+		for (int v = 0; v < n; v++) {
+			if (source < 0 || v == source) {
+				queue.push_back(v);
+				queued[v] = true;
+			}
+		}
+
+		while (!queue.empty()) {
+			int v = queue.front();
+			queue.pop_front();
+			queued[v] = false;
+
+			double dv = distance[v];
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				int w = csr->outTargets[a];
+				double dw = dv + csr->outWeights[a];
+
+				if (dw < distance[w]) {
+					distance[w] = dw;
+					predecessor[w] = v;
+					predecessorEdge[w] = csr->outEdgeIds[a];
+					length[w] = length[v] + 1;
+
+					if ((length[w] >= n || ++relaxations % n == 0)
+						&& findPredecessorCycle())
+					{
+						return;
+					}
+
+					if (!queued[w]) {
+						queued[w] = true;
+						queue.push_back(w);
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * The parallel round based variant, pulling over the incoming arcs.
+	 */
+	void runRounds()
+	{
+		int n = csr->vertexCount;
+		vector<double> next(distance);
+
+		for (int round = 0; round < n; round++) {
+			int changed = 0;
+
+			#pragma omp parallel for schedule(dynamic, 256) reduction(+:changed)
+			for (int v = 0; v < n; v++) {
+				double best = distance[v];
+				int bestArc = -1;
+
+				for (int a = csr->inOffsets[v]; a < csr->inOffsets[v + 1]; a++) {
+					double d = distance[csr->inSources[a]] + csr->inWeights[a];
+
+					if (d < best) {
+						best = d;
+						bestArc = a;
+					}
+				}
+
+				next[v] = best;
+				if (bestArc >= 0) {
+					predecessor[v] = csr->inSources[bestArc];
+					predecessorEdge[v] = csr->inEdgeIds[bestArc];
+					changed++;
+				}
+			}
+
+			distance.swap(next);
+
+			if (changed == 0 || findPredecessorCycle()) {
+				return;
+			}
+		}
+
+		findPredecessorCycle();
+	}
+
+	/**
+	 * Walks the predecessor edges from every vertex, stores the first
+	 * negative cycle met in <code>cycle</code> and reports whether there was
+	 * one.
+	 */
+	bool findPredecessorCycle()
+	{
+		int n = csr->vertexCount;
+		vector<int> walk(n, -1);
+
+		for (int start = 0; start < n; start++) {
+			int v = start;
+
+			while (v >= 0 && walk[v] < 0) {
+				walk[v] = start;
+				v = predecessor[v];
+			}
+
+			if (v < 0 || walk[v] != start) {
+				continue; // reached the source or an earlier walk
+			}
+
+			// v lies on a cycle of predecessor edges
+			vector<int> edgeIds;
+			double weight = 0.0;
+			int u = v;
+
+			do {
+				edgeIds.push_back(predecessorEdge[u]);
+				weight += csr->edgeWeights[predecessorEdge[u]];
+				u = predecessor[u];
+			} while (u != v);
+
+			if (weight < 0.0) {
+				cycle.assign(edgeIds.rbegin(), edgeIds.rend());
+				return true;
+			}
+		}
+
+		return false;
+	}
+};
+
+#endif /* BELLMANFORDSHORTESTPATH_H_ */
@@ -0,0 +1,466 @@
+#ifndef BETWEENNESSCENTRALITY_H_
+#define BETWEENNESSCENTRALITY_H_
+
+#include <cmath>
+#include <functional>
+#include <map>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * Betweenness centrality of the vertices and optionally the edges of a
+ * graph by the algorithm of Brandes ("A Faster Algorithm for Betweenness
+ * Centrality", 2001): the score of a vertex sums, over all pairs of other
+ * vertices, the fraction of shortest paths between them passing through it.
+ * Every source contributes the dependencies of the others, accumulated in
+ * reverse order of distance after a single-source search, a breadth-first
+ * search if all edge weights are <code>1</code> and Dijkstra's algorithm
+ * otherwise. Parallel edges are distinct paths. For undirected graphs every
+ * pair is counted once.
+ *
+ * <p>The sources run in parallel when compiled with OpenMP. Every thread
+ * keeps its own distances, path counts, dependencies and order of the
+ * vertices, which are reset for the reached vertices only, and its own
+ * scores, which are summed up at the end.</p>
+ *
+ * <p>Instead of all vertices, {@link #runApproximate} runs only <code>k
+ * </code> sources drawn uniformly at random and scales their dependencies by
+ * <code>n / k</code> (Brandes and Pich, "Centrality Estimation in Large
+ * Networks", 2007). Since a single dependency is at most <code>n - 2</code>,
+ * Hoeffding's inequality bounds the error of all normalized scores at once,
+ * see {@link #getErrorBound}.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class BetweennessCentrality
+{
+public:
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	bool weighted;
+	bool withEdges;
+	bool normalize;
+
+	/**
+	 * Score of every vertex by id and, if requested, of every edge by id.
+	 */
+	vector<double> vertexScore;
+	vector<double> edgeScore;
+
+	/**
+	 * Number of sources of the last run, <code>n</code> unless it was an
+	 * approximation.
+	 */
+	int sampleCount;
+
+	/**
+	 * Prepares the computation of the betweenness of the specified graph.
+	 *
+	 * @param g the graph
+	 * @param withEdges whether to compute the edge betweenness as well
+	 * @param normalize whether to divide the vertex scores by the number of
+	 * pairs of other vertices
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or has a
+	 * non-positive edge weight other than all edges weighing <code>1</code>.
+	 */
+	BetweennessCentrality(Graph<V, E>* g, bool withEdges = false, bool normalize = false)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g);
+		this->withEdges = withEdges;
+		this->normalize = normalize;
+		calculated = false;
+
+		weighted = false;
+		for (int e = 0; e < csr->edgeCount; e++) {
+			if (csr->edgeWeights[e] != 1.0) {
+				weighted = true;
+			}
+			if (csr->edgeWeights[e] <= 0.0) {
+				delete csr;
+				throw new invalid_argument("Edge weights must be positive");
+			}
+		}
+	}
+
+	virtual ~BetweennessCentrality()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Computes the exact scores, running every vertex as source.
+	 */
+	void run()
+	{
+		vector<int> sources(csr->vertexCount);
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			sources[v] = v;
+		}
+
+		accumulate(sources, 1.0, false);
+	}
+
+	/**
+	 * Estimates the scores from the specified number of sources, drawn
+	 * uniformly at random with replacement.
+	 *
+	 * @param samples number of sources
+	 * @param seed seed of the random source selection
+	 *
+	 * @throws invalid_argument if the number of sources is not positive.
+	 */
+	void runApproximate(int samples, unsigned int seed = 1)
+	{
+		if (samples <= 0) {
+			throw new invalid_argument("Number of samples must be positive");
+		}
+
+		int n = csr->vertexCount;
+		vector<int> sources(n > 0 ? samples : 0);
+		unsigned int state = seed;
+
+		for (int i = 0; i < (int) sources.size(); i++) {
+			sources[i] = nextSource(state, n);
+		}
+
+		accumulate(sources, (double) n / samples, true);
+	}
+
+	/**
+	 * Returns the score of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return betweenness of the vertex
+	 *
+	 * @throws logic_error if the scores were not computed yet.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	double getVertexScore(V* vertex)
+	{
+		checkCalculated();
+
+		int v = csr->indexOf(vertex);
+
+		if (v < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return vertexScore[v];
+	}
+
+	/**
+	 * Returns the scores of all vertices.
+	 *
+	 * @return map from the vertices to their betweenness
+	 *
+	 * @throws logic_error if the scores were not computed yet.
+	 */
+	map<V*, double>* getScores()
+	{
+		checkCalculated();
+
+		map<V*, double>* scores = new map<V*, double>();
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			(*scores)[csr->vertices[v]] = vertexScore[v];
+		}
+
+		return scores;
+	}
+
+	/**
+	 * Returns the scores of all edges, which are never normalized.
+	 *
+	 * @return map from the edges to their betweenness
+	 *
+	 * @throws logic_error if the scores were not computed yet or without the
+	 * edge betweenness.
+	 */
+	map<E*, double>* getEdgeScores()
+	{
+		checkCalculated();
+
+		if (!withEdges) {
+			throw new logic_error("Edge betweenness was not requested");
+		}
+
+		map<E*, double>* scores = new map<E*, double>();
+
+		for (int e = 0; e < csr->edgeCount; e++) {
+			(*scores)[csr->edges[e]] = edgeScore[e];
+		}
+
+		return scores;
+	}
+
+	/**
+	 * Returns a bound on the error of all normalized vertex scores of the
+	 * last run which holds with the specified probability, by Hoeffding's
+	 * inequality and the union bound over the vertices. The bound is
+	 * <code>0</code> after an exact run.
+	 *
+	 * @param confidence probability with which the bound holds, in <code>(0,
+	 * 1)</code>
+	 *
+	 * @return bound on the absolute error of the normalized scores
+	 *
+	 * @throws invalid_argument if the confidence is not in <code>(0,
+	 * 1)</code>.
+	 * @throws logic_error if the scores were not computed yet.
+	 */
+	double getErrorBound(double confidence)
+	{
+		if (!(confidence > 0.0 && confidence < 1.0)) {
+			throw new invalid_argument("Confidence must be in (0, 1)");
+		}
+
+		checkCalculated();
+
+		int n = csr->vertexCount;
+
+		if (!approximate || n < 3) {
+			return 0.0;
+		}
+
+		return (double) n / (n - 1)
+			* sqrt(log(2.0 * n / (1.0 - confidence)) / (2.0 * sampleCount));
+	}
+
+private:
+	typedef pair<double, int> Entry;
+
+	/**
+	 * Draws a vertex id uniformly from <code>[0, n)</code>. The high halves
+	 * of two steps of the generator form 32 random bits, and draws from the
+	 * incomplete last multiple of <code>n</code> are rejected, so every id
+	 * is equally likely on any graph size.
+	 */
+	static int nextSource(unsigned int& state, int n)
+	{
+		unsigned int bound = (unsigned int) n;
+		unsigned int skip = (0u - bound) % bound;
+		unsigned int bits;
+
+		do {
+			state = state * 1103515245u + 12345u;
+			bits = state & 0xffff0000u;
+			state = state * 1103515245u + 12345u;
+			bits |= state >> 16;
+		} while (bits < skip);
+
+		return (int) (bits % bound);
+	}
+
+	/**
+	 * The per-thread state of the single-source searches.
+	 */
+	struct Scratch
+	{
+		vector<double> distance;
+		vector<double> sigma;
+		vector<double> delta;
+		vector<int> order;
+		vector<double> vertexScore;
+		vector<double> edgeScore;
+
+		Scratch(int n, int m)
+			: distance(n, -1.0), sigma(n, 0.0), delta(n, 0.0), vertexScore(n, 0.0), edgeScore(m, 0.0)
+		{
+		}
+	};
+
+	bool calculated;
+	bool approximate;
+
+	void checkCalculated()
+	{
+		if (!calculated) {
+			throw new logic_error("Betweenness has not been calculated");
+		}
+	}
+
+	void accumulate(vector<int>& sources, double scale, bool approximate)
+	{
+		int n = csr->vertexCount;
+		int m = withEdges ? csr->edgeCount : 0;
+		int count = sources.size();
+
+		vertexScore.assign(n, 0.0);
+		edgeScore.assign(m, 0.0);
+
+		#pragma omp parallel
+		{
+			Scratch scratch(n, m);
+
+			#pragma omp for schedule(dynamic, 1) nowait
+			for (int i = 0; i < count; i++) {
+				if (weighted) {
+					dijkstra(sources[i], scratch);
+				} else {
+					bfs(sources[i], scratch);
+				}
+
+				dependencies(sources[i], scratch);
+			}
+
+			#pragma omp critical
+			{
+				for (int v = 0; v < n; v++) {
+					vertexScore[v] += scratch.vertexScore[v];
+				}
+				for (int e = 0; e < m; e++) {
+					edgeScore[e] += scratch.edgeScore[e];
+				}
+			}
+		}
+
+		// undirected pairs were counted from both ends
+		double factor = csr->directed ? scale : scale / 2.0;
+		double pairs = (double) (n - 1) * (n - 2);
+
+		if (!csr->directed) {
+			pairs /= 2.0;
+		}
+
+		for (int v = 0; v < n; v++) {
+			vertexScore[v] *= factor;
+
+			if (normalize && pairs > 0.0) {
+				vertexScore[v] /= pairs;
+			}
+		}
+		for (int e = 0; e < m; e++) {
+			edgeScore[e] *= factor;
+		}
+
+		sampleCount = count;
+		this->approximate = approximate;
+		calculated = true;
+	}
+
+	void bfs(int s, Scratch& scratch)
+	{
+		vector<double>& distance = scratch.distance;
+		vector<double>& sigma = scratch.sigma;
+		vector<int>& order = scratch.order;
+
+		distance[s] = 0.0;
+		sigma[s] = 1.0;
+		order.push_back(s);
+
+		for (int head = 0; head < (int) order.size(); head++) {
+			int v = order[head];
+
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				int w = csr->outTargets[a];
+
+				if (distance[w] < 0.0) {
+					distance[w] = distance[v] + 1.0;
+					order.push_back(w);
+				}
+				if (distance[w] == distance[v] + 1.0) {
+					sigma[w] += sigma[v];
+				}
+			}
+		}
+	}
+
+	void dijkstra(int s, Scratch& scratch)
+	{
+		vector<double>& distance = scratch.distance;
+		vector<double>& sigma = scratch.sigma;
+		vector<int>& order = scratch.order;
+		priority_queue<Entry, vector<Entry>, greater<Entry> > heap;
+
+		distance[s] = 0.0;
+		sigma[s] = 1.0;
+		heap.push(Entry(0.0, s));
+
+		// entries are only pushed on strict improvement, so the one with
+		// the final distance is unique
+		while (!heap.empty()) {
+			Entry top = heap.top();
+			heap.pop();
+
+			int v = top.second;
+
+			if (top.first > distance[v]) {
+				continue;
+			}
+
+			order.push_back(v);
+
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				int w = csr->outTargets[a];
+				double d = distance[v] + csr->outWeights[a];
+
+				if (distance[w] < 0.0 || d < distance[w]) {
+					distance[w] = d;
+					sigma[w] = sigma[v];
+					heap.push(Entry(d, w));
+				} else if (d == distance[w]) {
+					sigma[w] += sigma[v];
+				}
+			}
+		}
+	}
+
+	/**
+	 * Accumulates the dependencies of the source in reverse order of
+	 * distance, finding the successors on shortest paths by their distance,
+	 * and resets the reached vertices.
+	 */
+	void dependencies(int s, Scratch& scratch)
+	{
+		vector<double>& distance = scratch.distance;
+		vector<double>& sigma = scratch.sigma;
+		vector<double>& delta = scratch.delta;
+		vector<int>& order = scratch.order;
+
+		for (int i = order.size() - 1; i >= 0; i--) {
+			int v = order[i];
+			double sum = 0.0;
+
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				int w = csr->outTargets[a];
+
+				if (distance[w] == distance[v] + csr->outWeights[a]) {
+					double share = sigma[v] / sigma[w] * (1.0 + delta[w]);
+
+					sum += share;
+
+					if (withEdges) {
+						scratch.edgeScore[csr->outEdgeIds[a]] += share;
+					}
+				}
+			}
+
+			delta[v] = sum;
+
+			if (v != s) {
+				scratch.vertexScore[v] += sum;
+			}
+		}
+
+		for (int i = 0; i < (int) order.size(); i++) {
+			int v = order[i];
+
+			distance[v] = -1.0;
+			sigma[v] = 0.0;
+			delta[v] = 0.0;
+		}
+
+		order.clear();
+	}
+};
+
+#endif /* BETWEENNESSCENTRALITY_H_ */
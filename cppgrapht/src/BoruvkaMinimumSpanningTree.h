@@ -0,0 +1,263 @@
+#ifndef BORUVKAMINIMUMSPANNINGTREE_H_
+#define BORUVKAMINIMUMSPANNINGTREE_H_
+
+#include <set>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * Borůvka's algorithm computing a minimum spanning forest of a weighted
+ * graph; edge directions are ignored. Edges are ordered by weight and then
+ * by edge id of the {@link CSRGraph} snapshot, so all weights are distinct
+ * in effect and the result equals that of {@link
+ * KruskalMinimumSpanningTree}.
+ *
+ * <p>Every round each component selects its lightest outgoing edge. All
+ * selected edges belong to the forest, and their components merge. Since
+ * every round at least halves the number of components there are at most
+ * <code>log n</code> rounds, each of which is parallel when compiled with
+ * OpenMP:</p>
+ *
+ * <ol>
+ * <li>all remaining edges offer themselves to the components of both end
+ * points, which keep the lightest offer by a compare-and-swap loop;</li>
+ * <li>every component hooks itself onto the component at the other end of
+ * its selected edge. Two components selecting the same edge form the only
+ * possible cycle; the one with the lower id stays the root;</li>
+ * <li>pointer jumping makes every vertex point at its root again;</li>
+ * <li>edges inside a component are dropped.</li>
+ * </ol>
+ *
+ * @see KruskalMinimumSpanningTree
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class BoruvkaMinimumSpanningTree
+{
+public:
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * Edge ids of the spanning forest, ordered by round.
+	 */
+	vector<int> treeEdges;
+
+	double totalWeight;
+
+	/**
+	 * Computes a minimum spanning forest of the specified graph.
+	 *
+	 * @param g the graph
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	BoruvkaMinimumSpanningTree(Graph<V, E>* g)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+		ownsSnapshot = true;
+
+		run();
+	}
+
+	/**
+	 * Computes a minimum spanning forest from the edge arrays of an existing
+	 * snapshot, which is neither copied nor deleted.
+	 *
+	 * @param snapshot snapshot of the graph
+	 */
+	BoruvkaMinimumSpanningTree(CSRGraph<V, E>* snapshot)
+	{
+		graph = snapshot->graph;
+		csr = snapshot;
+		ownsSnapshot = false;
+
+		run();
+	}
+
+	virtual ~BoruvkaMinimumSpanningTree()
+	{
+		if (ownsSnapshot) {
+			delete csr;
+		}
+	}
+
+	/**
+	 * Returns the edges of the minimum spanning forest.
+	 *
+	 * @return set of the tree edges
+	 */
+	set<E*>* getMinimumSpanningTreeEdgeSet()
+	{
+		set<E*>* edgeSet = new set<E*>();
+
+		for (int i = 0; i < (int) treeEdges.size(); i++) {
+			edgeSet->insert(csr->edges[treeEdges[i]]);
+		}
+
+		return edgeSet;
+	}
+
+	/**
+	 * Returns the total weight of the minimum spanning forest.
+	 *
+	 * @return sum of the weights of the tree edges
+	 */
+	double getMinimumSpanningTreeTotalWeight()
+	{
+		return totalWeight;
+	}
+
+private:
+	bool ownsSnapshot;
+
+	/**
+	 * Whether edge a precedes edge b in the order of (weight, id).
+	 */
+	bool lighter(int a, int b)
+	{
+		double wa = csr->edgeWeights[a];
+		double wb = csr->edgeWeights[b];
+
+		return wa < wb || (wa == wb && a < b);
+	}
+
+	/**
+	 * Lowers the selected edge of a component to the specified edge unless
+	 * it already holds a lighter one.
+	 */
+	void offer(int* selected, int e)
+	{
+		int current = *selected;
+
+		while (current < 0 || lighter(e, current)) {
+			int seen = __sync_val_compare_and_swap(selected, current, e);
+
+			if (seen == current) {
+				return;
+			}
+
+			current = seen;
+		}
+	}
+
+	void run()
+	{
+		int n = csr->vertexCount;
+		vector<int> parent(n);
+		vector<int> selected(n, -1);
+		vector<int> edges;
+
+		for (int v = 0; v < n; v++) {
+			parent[v] = v;
+		}
+		for (int e = 0; e < csr->edgeCount; e++) {
+			if (csr->edgeSources[e] != csr->edgeTargets[e]) {
+				edges.push_back(e);
+			}
+		}
+
+		totalWeight = 0.0;
+
+		while (!edges.empty()) {
+			int m = edges.size();
+
+			#pragma omp parallel for schedule(dynamic, 4096)
+			for (int i = 0; i < m; i++) {
+				int e = edges[i];
+
+				offer(&selected[parent[csr->edgeSources[e]]], e);
+				offer(&selected[parent[csr->edgeTargets[e]]], e);
+			}
+
+			// hook every root onto the root across its selected edge
+			vector<int> chosen;
+
+			#pragma omp parallel
+			{
+				vector<int> local;
+
+				#pragma omp for schedule(dynamic, 4096) nowait
+				for (int c = 0; c < n; c++) {
+					int e = selected[c];
+
+					if (e < 0) {
+						continue;
+					}
+
+					int u = parent[csr->edgeSources[e]];
+					int other = u == c ? parent[csr->edgeTargets[e]] : u;
+
+					if (selected[other] != e || c > other) {
+						local.push_back(c);
+					}
+				}
+
+				#pragma omp critical
+				chosen.insert(chosen.end(), local.begin(), local.end());
+			}
+
+			vector<int> hookTo(chosen.size());
+
+			for (int i = 0; i < (int) chosen.size(); i++) {
+				int c = chosen[i];
+				int e = selected[c];
+				int u = parent[csr->edgeSources[e]];
+
+				hookTo[i] = u == c ? parent[csr->edgeTargets[e]] : u;
+				treeEdges.push_back(e);
+				totalWeight += csr->edgeWeights[e];
+			}
+
+			#pragma omp parallel for schedule(static)
+			for (int i = 0; i < (int) chosen.size(); i++) {
+				parent[chosen[i]] = hookTo[i];
+			}
+
+			#pragma omp parallel for schedule(static)
+			for (int c = 0; c < n; c++) {
+				selected[c] = -1;
+			}
+
+			for (int changed = 1; changed > 0;) {
+				changed = 0;
+
+				#pragma omp parallel for schedule(dynamic, 4096) reduction(+:changed)
+				for (int v = 0; v < n; v++) {
+					int grandparent = parent[parent[v]];
+
+					if (parent[v] != grandparent) {
+						parent[v] = grandparent;
+						changed++;
+					}
+				}
+			}
+
+			// drop the edges inside a component, order does not matter
+			vector<int> remaining;
+
+			#pragma omp parallel
+			{
+				vector<int> local;
+
+				#pragma omp for schedule(dynamic, 4096) nowait
+				for (int i = 0; i < m; i++) {
+					int e = edges[i];
+
+					if (parent[csr->edgeSources[e]] != parent[csr->edgeTargets[e]]) {
+						local.push_back(e);
+					}
+				}
+
+				#pragma omp critical
+				remaining.insert(remaining.end(), local.begin(), local.end());
+			}
+
+			edges.swap(remaining);
+		}
+	}
+};
+
+#endif /* BORUVKAMINIMUMSPANNINGTREE_H_ */
@@ -0,0 +1,283 @@
+#ifndef CSRGRAPH_H_
+#define CSRGRAPH_H_
+
+#include <map>
+#include <vector>
+#include <stdexcept>
+#include <Graph.h>
+#include <DirectedGraph.h>
+
+/**
+ * A read-only compressed sparse row (CSR) snapshot of a {@link Graph}. The
+ * vertices of the graph are numbered densely from <code>0</code> to <code>
+ * vertexCount - 1</code> and the edges from <code>0</code> to <code>
+ * edgeCount - 1</code>; algorithms run on these flat arrays instead of the
+ * pointer based sets of the graph itself.
+ *
+ * <p>The snapshot keeps three views of the edges:</p>
+ *
+ * <ul>
+ * <li>the edge arrays <code>edgeSources</code>, <code>edgeTargets</code> and
+ * <code>edgeWeights</code>, indexed by edge id;</li>
+ * <li>the outgoing arcs of every vertex <code>v</code> in the range <code>
+ * [outOffsets[v], outOffsets[v + 1])</code> of <code>outTargets</code>,
+ * <code>outWeights</code> and <code>outEdgeIds</code>;</li>
+ * <li>optionally the incoming arcs in the same layout (<code>inOffsets</code>,
+ * <code>inSources</code>, <code>inWeights</code>, <code>inEdgeIds</code>).</li>
+ * </ul>
+ *
+ * <p>For undirected graphs every edge yields an arc in both directions (a
+ * self-loop yields a single arc) and the incoming arcs equal the outgoing
+ * ones.</p>
+ *
+ * <p>The snapshot is not updated when the graph changes.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class CSRGraph
+{
+public:
+	Graph<V, E>* graph;
+	bool directed;
+	bool hasIncoming;
+	int vertexCount;
+	int edgeCount;
+
+	vector<V*> vertices;
+	map<V*, int> vertexIndex;
+
+	vector<E*> edges;
+	vector<int> edgeSources;
+	vector<int> edgeTargets;
+	vector<double> edgeWeights;
+
+	vector<int> outOffsets;
+	vector<int> outTargets;
+	vector<double> outWeights;
+	vector<int> outEdgeIds;
+
+	vector<int> inOffsets;
+	vector<int> inSources;
+	vector<double> inWeights;
+	vector<int> inEdgeIds;
+
+	/**
+	 * Creates a snapshot of the specified graph. The graph is treated as
+	 * directed if and only if it implements {@link DirectedGraph}.
+	 *
+	 * @param g the graph to take the snapshot of.
+	 * @param withIncoming whether to also build the incoming arcs.
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	CSRGraph(Graph<V, E>* g, bool withIncoming = false)
+	{
+		if (g == NULL) {
+			throw new invalid_argument("NULL-pointer given for g");
+		}
+
+		init(g, dynamic_cast<DirectedGraph<V, E>*>(g) != NULL, withIncoming);
+	}
+
+	/**
+	 * Creates a snapshot of the specified graph, forcing the given
+	 * directedness. Passing <code>false</code> for a directed graph yields
+	 * its underlying undirected graph.
+	 *
+	 * @param g the graph to take the snapshot of.
+	 * @param directed whether the edges are to be treated as directed.
+	 * @param withIncoming whether to also build the incoming arcs.
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	CSRGraph(Graph<V, E>* g, bool directed, bool withIncoming)
+	{
+		if (g == NULL) {
+			throw new invalid_argument("NULL-pointer given for g");
+		}
+
+		init(g, directed, withIncoming);
+	}
+
+	/**
+	 * Returns the dense id of the specified vertex, or <code>-1</code> if the
+	 * vertex was not part of the graph when the snapshot was taken.
+	 *
+	 * @param v vertex of interest
+	 *
+	 * @return id of the vertex
+	 */
+	int indexOf(V* v)
+	{
+		typename map<V*, int>::iterator it = vertexIndex.find(v);
+
+		return it == vertexIndex.end() ? -1 : it->second;
+	}
+
+	/**
+	 * Returns the number of arcs leaving the vertex with the specified id.
+	 *
+	 * @param v vertex id
+	 *
+	 * @return out degree of the vertex
+	 */
+	int outDegreeOf(int v)
+	{
+		return outOffsets[v + 1] - outOffsets[v];
+	}
+
+	/**
+	 * Returns the number of arcs entering the vertex with the specified id.
+	 * Only valid if the incoming arcs were built.
+	 *
+	 * @param v vertex id
+	 *
+	 * @return in degree of the vertex
+	 */
+	int inDegreeOf(int v)
+	{
+		return inOffsets[v + 1] - inOffsets[v];
+	}
+
+	/**
+	 * Returns whether any edge of the snapshot has a negative weight.
+	 *
+	 * @return <code>true</code> if a negative edge weight exists.
+	 */
+	bool hasNegativeEdgeWeight()
+	{
+		for (int i = 0; i < edgeCount; i++) {
+			if (edgeWeights[i] < 0.0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Groups the given arcs by their tail with a counting sort. The arrays
+	 * <code>heads</code>, <code>weights</code> and <code>ids</code> receive
+	 * the arcs and <code>offsets</code> the <code>n + 1</code> row bounds.
+	 *
+	 * @param n number of vertices
+	 * @param tails tail of every arc
+	 * @param arcHeads head of every arc
+	 * @param arcWeights weight of every arc
+	 * @param arcIds edge id of every arc
+	 * @param offsets receives the row bounds
+	 * @param heads receives the arc heads
+	 * @param weights receives the arc weights
+	 * @param ids receives the arc edge ids
+	 */
+	static void buildRows(
+		int n,
+		const vector<int>& tails,
+		const vector<int>& arcHeads,
+		const vector<double>& arcWeights,
+		const vector<int>& arcIds,
+		vector<int>& offsets,
+		vector<int>& heads,
+		vector<double>& weights,
+		vector<int>& ids)
+	{
+		int arcs = tails.size();
+
+		offsets.assign(n + 1, 0);
+		for (int i = 0; i < arcs; i++) {
+			offsets[tails[i] + 1]++;
+		}
+		for (int v = 0; v < n; v++) {
+			offsets[v + 1] += offsets[v];
+		}
+
+		heads.resize(arcs);
+		weights.resize(arcs);
+		ids.resize(arcs);
+
+		vector<int> next(offsets.begin(), offsets.end() - 1);
+		for (int i = 0; i < arcs; i++) {
+			int pos = next[tails[i]]++;
+			heads[pos] = arcHeads[i];
+			weights[pos] = arcWeights[i];
+			ids[pos] = arcIds[i];
+		}
+	}
+
+private:
+	void init(Graph<V, E>* g, bool directed, bool withIncoming)
+	{
+		this->graph = g;
+		this->directed = directed;
+		this->hasIncoming = withIncoming;
+
+		const set<V*>* vset = g->vertexSet();
+		vertexCount = vset->size();
+		vertices.reserve(vertexCount);
+
+		typename set<V*>::const_iterator vit;
+		for (vit = vset->begin(); vit != vset->end(); ++vit) {
+			vertexIndex.insert(pair<V*, int>(*vit, vertices.size()));
+			vertices.push_back(*vit);
+		}
+
+		const set<E*>* eset = g->edgeSet();
+		edgeCount = eset->size();
+		edges.reserve(edgeCount);
+		edgeSources.reserve(edgeCount);
+		edgeTargets.reserve(edgeCount);
+		edgeWeights.reserve(edgeCount);
+
+		typename set<E*>::const_iterator eit;
+		for (eit = eset->begin(); eit != eset->end(); ++eit) {
+			int source = indexOf(g->getEdgeSource(*eit));
+			int target = indexOf(g->getEdgeTarget(*eit));
+
+			if (source < 0 || target < 0) {
+				throw new invalid_argument("Edge endpoint not in the vertex set");
+			}
+
+			edges.push_back(*eit);
+			edgeSources.push_back(source);
+			edgeTargets.push_back(target);
+			edgeWeights.push_back(g->getEdgeWeight(*eit));
+		}
+
+		vector<int> tails;
+		vector<int> heads;
+		vector<double> weights;
+		vector<int> ids;
+
+		for (int i = 0; i < edgeCount; i++) {
+			tails.push_back(edgeSources[i]);
+			heads.push_back(edgeTargets[i]);
+			weights.push_back(edgeWeights[i]);
+			ids.push_back(i);
+
+			if (!directed && edgeSources[i] != edgeTargets[i]) {
+				tails.push_back(edgeTargets[i]);
+				heads.push_back(edgeSources[i]);
+				weights.push_back(edgeWeights[i]);
+				ids.push_back(i);
+			}
+		}
+
+		buildRows(vertexCount, tails, heads, weights, ids,
+			outOffsets, outTargets, outWeights, outEdgeIds);
+
+		if (withIncoming) {
+			if (directed) {
+				buildRows(vertexCount, heads, tails, weights, ids,
+					inOffsets, inSources, inWeights, inEdgeIds);
+			} else {
+				inOffsets = outOffsets;
+				inSources = outTargets;
+				inWeights = outWeights;
+				inEdgeIds = outEdgeIds;
+			}
+		}
+	}
+};
+
+#endif /* CSRGRAPH_H_ */
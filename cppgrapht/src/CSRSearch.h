@@ -0,0 +1,274 @@
+#ifndef CSRSEARCH_H_
+#define CSRSEARCH_H_
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <list>
+#include <vector>
+#include <CSRGraph.h>
+#include <GraphPathImpl.h>
+
+/**
+ * The trivial id level heuristic for {@link CSRSearch}, turning the search
+ * into Dijkstra's algorithm.
+ *
+ * @since 2026-10-18
+ */
+class ZeroHeuristic
+{
+public:
+	double operator()(int, int) const
+	{
+		return 0.0;
+	}
+};
+
+/**
+ * A reusable best-first shortest path search over a {@link CSRGraph}. The
+ * search is Dijkstra's algorithm guided by a heuristic functor which is a
+ * template parameter of {@link #run}, so no virtual call happens per
+ * relaxation. A functor <code>h</code> is called as <code>h(v, target)</code>
+ * with dense vertex ids and has to return a lower bound of the distance from
+ * <code>v</code> to <code>target</code>; with an admissible but inconsistent
+ * heuristic vertices may be expanded more than once.
+ *
+ * <p>All edge weights must be non-negative. The working arrays are kept
+ * between runs and invalidated in constant time, so a single instance can
+ * answer many queries cheaply. An instance must not be shared between
+ * threads.</p>
+ *
+ * <p>Vertices and edges can be hidden from the search by the bitsets
+ * <code>vertexMask</code> and <code>edgeMask</code>, one bit per id, which
+ * the caller owns and may change between runs. A masked vertex is never
+ * reached unless it is the source.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class CSRSearch
+{
+public:
+	CSRGraph<V, E>* csr;
+
+	vector<double> distance;
+	vector<double> estimate;
+	vector<int> predecessor;
+	vector<int> predecessorEdge;
+	vector<unsigned int> reached;
+	unsigned int stamp;
+
+	int source;
+	bool backward;
+	int settledCount;
+
+	vector<pair<double, int> > heap;
+
+	/**
+	 * Bits per word of a mask.
+	 */
+	static const int MASK_BITS = sizeof(unsigned long) * 8;
+
+	/**
+	 * Masks of the vertices and edges the search must not use, or <code>
+	 * NULL</code> if none are masked.
+	 */
+	const vector<unsigned long>* vertexMask;
+	const vector<unsigned long>* edgeMask;
+
+	/**
+	 * Creates a search over the specified snapshot.
+	 *
+	 * @param csr the snapshot to search. Backward searches need its incoming
+	 * arcs.
+	 */
+	CSRSearch(CSRGraph<V, E>* csr)
+	{
+		this->csr = csr;
+		distance.resize(csr->vertexCount);
+		estimate.resize(csr->vertexCount);
+		predecessor.resize(csr->vertexCount);
+		predecessorEdge.resize(csr->vertexCount);
+		reached.assign(csr->vertexCount, 0);
+		stamp = 0;
+		source = -1;
+		backward = false;
+		settledCount = 0;
+		vertexMask = NULL;
+		edgeMask = NULL;
+	}
+
+	/**
+	 * Runs a search from the specified source. If <code>target</code> is
+	 * <code>-1</code> the search settles every reachable vertex, otherwise it
+	 * stops as soon as the target is settled.
+	 *
+	 * @param source id of the source vertex
+	 * @param target id of the target vertex, or <code>-1</code>
+	 * @param heuristic admissible heuristic towards the target
+	 * @param backward whether to follow the incoming arcs, i.e. to compute
+	 * distances <i>to</i> the source
+	 *
+	 * @return <code>true</code> if the target (or, without target, any
+	 * vertex) was reached.
+	 */
+	template <class H>
+	bool run(int source, int target, H& heuristic, bool backward = false)
+	{
+		const vector<int>& offsets = backward ? csr->inOffsets : csr->outOffsets;
+		const vector<int>& heads = backward ? csr->inSources : csr->outTargets;
+		const vector<double>& weights = backward ? csr->inWeights : csr->outWeights;
+		const vector<int>& ids = backward ? csr->inEdgeIds : csr->outEdgeIds;
+
+		nextStamp();
+		this->source = source;
+		this->backward = backward;
+		settledCount = 0;
+		heap.clear();
+
+		reach(source, 0.0, -1, -1, target, heuristic);
+
+		while (!heap.empty()) {
+			pair<double, int> top = heap.front();
+			pop_heap(heap.begin(), heap.end(), greater<pair<double, int> >());
+			heap.pop_back();
+
+			int v = top.second;
+			if (top.first > distance[v] + estimate[v]) {
+				continue; // stale entry
+			}
+
+			settledCount++;
+			if (v == target) {
+				return true;
+			}
+
+			double dv = distance[v];
+			for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+				int w = heads[a];
+				double dw = dv + weights[a];
+
+				if ((edgeMask != NULL && isMasked(*edgeMask, ids[a]))
+					|| (vertexMask != NULL && isMasked(*vertexMask, w)))
+				{
+					continue;
+				}
+
+				if (reached[w] != stamp || dw < distance[w]) {
+					reach(w, dw, v, ids[a], target, heuristic);
+				}
+			}
+		}
+
+		return target < 0 && settledCount > 0;
+	}
+
+	/**
+	 * Runs Dijkstra's algorithm from the specified source, settling every
+	 * reachable vertex.
+	 *
+	 * @param source id of the source vertex
+	 * @param backward whether to follow the incoming arcs
+	 */
+	void runAll(int source, bool backward = false)
+	{
+		ZeroHeuristic h;
+		run(source, -1, h, backward);
+	}
+
+	/**
+	 * Returns whether the vertex was reached by the last run.
+	 *
+	 * @param v vertex id
+	 *
+	 * @return <code>true</code> if a path to the vertex was found.
+	 */
+	bool isReached(int v)
+	{
+		return reached[v] == stamp;
+	}
+
+	/**
+	 * Returns the distance found by the last run, which is exact for settled
+	 * vertices, or infinity if the vertex was not reached.
+	 *
+	 * @param v vertex id
+	 *
+	 * @return distance of the vertex
+	 */
+	double getDistance(int v)
+	{
+		return isReached(v) ? distance[v] : numeric_limits<double>::infinity();
+	}
+
+	/**
+	 * Builds the path from the source of the last forward run to the
+	 * specified vertex.
+	 *
+	 * @param target vertex id
+	 *
+	 * @return the path, or <code>NULL</code> if the vertex was not reached.
+	 */
+	GraphPath<V, E>* getPath(int target)
+	{
+		if (!isReached(target)) {
+			return NULL;
+		}
+
+		list<E*>* edgeList = new list<E*>();
+		for (int v = target; v != source; v = predecessor[v]) {
+			edgeList->push_front(csr->edges[predecessorEdge[v]]);
+		}
+
+		return new GraphPathImpl<V, E>(
+			csr->graph,
+			csr->vertices[source],
+			csr->vertices[target],
+			edgeList,
+			distance[target]);
+	}
+
+	/**
+	 * Returns whether the bit of the specified id is set in a mask.
+	 *
+	 * @param mask the mask, one bit per id
+	 * @param id vertex or edge id
+	 *
+	 * @return <code>true</code> if the id is masked.
+	 */
+	static bool isMasked(const vector<unsigned long>& mask, int id)
+	{
+		return (mask[id / MASK_BITS] >> (id % MASK_BITS)) & 1UL;
+	}
+
+private:
+	void nextStamp()
+	{
+		if (++stamp == 0) {
+			reached.assign(reached.size(), 0);
+			stamp = 1;
+		}
+	}
+
+	template <class H>
+	void reach(int v, double d, int pred, int edge, int target, H& heuristic)
+	{
+		if (reached[v] != stamp) {
+			reached[v] = stamp;
+			estimate[v] = target < 0 ? 0.0 : heuristic(v, target);
+		}
+
+		distance[v] = d;
+		predecessor[v] = pred;
+		predecessorEdge[v] = edge;
+
+		if (estimate[v] == numeric_limits<double>::infinity()) {
+			return; // the target is provably unreachable from v
+		}
+
+		heap.push_back(pair<double, int>(d + estimate[v], v));
+		push_heap(heap.begin(), heap.end(), greater<pair<double, int> >());
+	}
+};
+
+#endif /* CSRSEARCH_H_ */
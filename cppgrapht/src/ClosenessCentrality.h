@@ -0,0 +1,497 @@
+#ifndef CLOSENESSCENTRALITY_H_
+#define CLOSENESSCENTRALITY_H_
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <map>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * Closeness and harmonic centrality of the vertices of a graph, by hop
+ * distance along the outgoing edges; edge weights are ignored.
+ *
+ * <ul>
+ * <li>The closeness of a vertex reaching <code>r</code> vertices (itself
+ * included) at total distance <code>d</code> is <code>(r - 1) / d</code>,
+ * and <code>0</code> if it reaches no other vertex.</li>
+ * <li>The harmonic centrality is the sum of the reciprocal distances to all
+ * other vertices, divided by <code>n - 1</code>. Unreachable vertices add
+ * nothing.</li>
+ * </ul>
+ *
+ * <p>Both need a breadth-first search from every vertex, which are run as
+ * multi-source breadth-first searches (Then et al., "The More the Merrier:
+ * Efficient Multi-Source Graph Traversal", VLDB 2014): a batch of 256
+ * sources by default is searched at once, every vertex holding one bit per
+ * source for having been seen and for being in the current frontier. A
+ * single scan of the arcs of a frontier vertex thus advances all sources
+ * having it in their frontier, by OR-ing whole words. The batches run in
+ * parallel when compiled with OpenMP, every thread with its own bit
+ * sets.</p>
+ *
+ * <p>If only the most central vertices are needed, {@link #runTopK} bounds
+ * the final score of every source after each level from the vertices seen
+ * so far, all others being at least one level further away, and drops the
+ * sources which cannot beat the current <code>k</code>-th best score from
+ * their batch (Bergamini et al., "Computing Top-k Closeness Centrality
+ * Faster in Unweighted Graphs", ALENEX 2016). Sources are taken by
+ * descending degree so that a good threshold is found early.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class ClosenessCentrality
+{
+public:
+	enum Measure { CLOSENESS, HARMONIC };
+
+	static const int DEFAULT_BATCH_SIZE = 256;
+
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * Number of sources per multi-source search, a multiple of 64.
+	 */
+	int batchSize;
+
+	/**
+	 * Scores of every vertex by id after {@link #run}.
+	 */
+	vector<double> closeness;
+	vector<double> harmonic;
+
+	/**
+	 * Ids and scores of the vertices found by {@link #runTopK}, best
+	 * first.
+	 */
+	vector<int> topVertices;
+	vector<double> topScores;
+
+	/**
+	 * Prepares the computation of the centralities of the specified graph.
+	 *
+	 * @param g the graph
+	 * @param batchSize number of sources per multi-source search, a
+	 * positive multiple of 64
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or the
+	 * batch size is not a positive multiple of 64.
+	 */
+	ClosenessCentrality(Graph<V, E>* g, int batchSize = DEFAULT_BATCH_SIZE)
+	{
+		if (batchSize <= 0 || batchSize % WORD_BITS != 0) {
+			throw new invalid_argument("Batch size must be a positive multiple of 64");
+		}
+
+		graph = g;
+		csr = new CSRGraph<V, E>(g);
+		this->batchSize = batchSize;
+		calculated = false;
+	}
+
+	virtual ~ClosenessCentrality()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Computes the closeness and harmonic centrality of all vertices.
+	 */
+	void run()
+	{
+		int n = csr->vertexCount;
+		vector<int> sources(n);
+
+		for (int v = 0; v < n; v++) {
+			sources[v] = v;
+		}
+
+		closeness.assign(n, 0.0);
+		harmonic.assign(n, 0.0);
+		topK = 0;
+
+		search(sources, CLOSENESS);
+
+		calculated = true;
+	}
+
+	/**
+	 * Computes the vertices with the highest score under the specified
+	 * measure, pruning the searches of all others. Ties are broken
+	 * arbitrarily.
+	 *
+	 * @param k number of vertices to find
+	 * @param measure the centrality to rank by
+	 *
+	 * @throws invalid_argument if <code>k</code> is not positive.
+	 */
+	void runTopK(int k, Measure measure)
+	{
+		if (k <= 0) {
+			throw new invalid_argument("k must be positive");
+		}
+
+		int n = csr->vertexCount;
+		vector<pair<int, int> > byDegree(n);
+
+		for (int v = 0; v < n; v++) {
+			byDegree[v] = pair<int, int>(-csr->outDegreeOf(v), v);
+		}
+		sort(byDegree.begin(), byDegree.end());
+
+		vector<int> sources(n);
+		for (int i = 0; i < n; i++) {
+			sources[i] = byDegree[i].second;
+		}
+
+		topK = k;
+		top.clear();
+		threshold = -1.0;
+
+		search(sources, measure);
+
+		sort(top.begin(), top.end(), greater<Entry>());
+		topVertices.resize(top.size());
+		topScores.resize(top.size());
+
+		for (int i = 0; i < (int) top.size(); i++) {
+			topScores[i] = top[i].first;
+			topVertices[i] = top[i].second;
+		}
+	}
+
+	/**
+	 * Returns the closeness of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return closeness of the vertex
+	 *
+	 * @throws logic_error if the scores were not computed by {@link #run}.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	double getClosenessScore(V* vertex)
+	{
+		return closeness[indexOf(vertex)];
+	}
+
+	/**
+	 * Returns the harmonic centrality of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return harmonic centrality of the vertex
+	 *
+	 * @throws logic_error if the scores were not computed by {@link #run}.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	double getHarmonicScore(V* vertex)
+	{
+		return harmonic[indexOf(vertex)];
+	}
+
+	/**
+	 * Returns the scores of all vertices under the specified measure.
+	 *
+	 * @param measure the centrality
+	 *
+	 * @return map from the vertices to their score
+	 *
+	 * @throws logic_error if the scores were not computed by {@link #run}.
+	 */
+	map<V*, double>* getScores(Measure measure)
+	{
+		checkCalculated();
+
+		vector<double>& score = measure == CLOSENESS ? closeness : harmonic;
+		map<V*, double>* scores = new map<V*, double>();
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			(*scores)[csr->vertices[v]] = score[v];
+		}
+
+		return scores;
+	}
+
+	/**
+	 * Returns the vertices found by the last {@link #runTopK}.
+	 *
+	 * @return the vertices, best first
+	 */
+	list<V*>* getTopVertices()
+	{
+		list<V*>* vertices = new list<V*>();
+
+		for (int i = 0; i < (int) topVertices.size(); i++) {
+			vertices->push_back(csr->vertices[topVertices[i]]);
+		}
+
+		return vertices;
+	}
+
+private:
+	typedef unsigned long Word;
+	typedef pair<double, int> Entry;
+
+	static const int WORD_BITS = 64;
+
+	bool calculated;
+
+	// the top-k state, a min-heap of the best scores so far
+	int topK;
+	vector<Entry> top;
+	double threshold;
+
+	/**
+	 * The per-thread bit sets of a multi-source search, <code>words</code>
+	 * words per vertex.
+	 */
+	struct Scratch
+	{
+		vector<Word> seen;
+		vector<Word> visit;
+		vector<Word> next;
+		vector<Word> active;
+		vector<int> reached;
+		vector<long> distanceSum;
+		vector<double> harmonicSum;
+
+		Scratch(int n, int words)
+			: seen((long) n * words), visit((long) n * words), next((long) n * words),
+			active(words), reached(words * WORD_BITS), distanceSum(words * WORD_BITS),
+			harmonicSum(words * WORD_BITS)
+		{
+		}
+	};
+
+	int indexOf(V* vertex)
+	{
+		checkCalculated();
+
+		int v = csr->indexOf(vertex);
+
+		if (v < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return v;
+	}
+
+	void checkCalculated()
+	{
+		if (!calculated) {
+			throw new logic_error("Centrality has not been calculated");
+		}
+	}
+
+	void search(vector<int>& sources, Measure measure)
+	{
+		int n = csr->vertexCount;
+		int words = batchSize / WORD_BITS;
+		int batches = (n + batchSize - 1) / batchSize;
+
+		#pragma omp parallel
+		{
+			Scratch* scratch = NULL;
+
+			#pragma omp for schedule(dynamic, 1)
+			for (int b = 0; b < batches; b++) {
+				if (scratch == NULL) {
+					scratch = new Scratch(n, words);
+				}
+
+				int first = b * batchSize;
+				int count = min(batchSize, n - first);
+
+				searchBatch(&sources[first], count, measure, *scratch);
+			}
+
+			delete scratch;
+		}
+	}
+
+	double closenessOf(int reached, long distanceSum)
+	{
+		return distanceSum > 0 ? (reached - 1) / (double) distanceSum : 0.0;
+	}
+
+	/**
+	 * Upper bound on the final score of a source having reached the given
+	 * vertices within the given level, all others being further away.
+	 */
+	double bound(Measure measure, int reached, long distanceSum, double harmonicSum, int level)
+	{
+		int n = csr->vertexCount;
+		int rest = n - reached;
+
+		if (measure == HARMONIC) {
+			return (harmonicSum + rest / (level + 1.0)) / (n - 1);
+		}
+
+		// (reached - 1 + x) / (distanceSum + x (level + 1)) is monotone in x
+		return max(
+			closenessOf(reached, distanceSum),
+			(n - 1) / (double) (distanceSum + (long) rest * (level + 1)));
+	}
+
+	void searchBatch(int* sources, int count, Measure measure, Scratch& scratch)
+	{
+		int n = csr->vertexCount;
+		int words = batchSize / WORD_BITS;
+		Word* seen = &scratch.seen[0];
+		Word* visit = &scratch.visit[0];
+		Word* next = &scratch.next[0];
+		Word* active = &scratch.active[0];
+
+		fill(scratch.seen.begin(), scratch.seen.end(), 0UL);
+		fill(scratch.visit.begin(), scratch.visit.end(), 0UL);
+		fill(scratch.next.begin(), scratch.next.end(), 0UL);
+		fill(scratch.active.begin(), scratch.active.end(), 0UL);
+
+		for (int i = 0; i < count; i++) {
+			Word bit = 1UL << (i % WORD_BITS);
+			long slot = (long) sources[i] * words + i / WORD_BITS;
+
+			seen[slot] |= bit;
+			visit[slot] |= bit;
+			active[i / WORD_BITS] |= bit;
+			scratch.reached[i] = 1;
+			scratch.distanceSum[i] = 0;
+			scratch.harmonicSum[i] = 0.0;
+		}
+
+		for (int level = 1; ; level++) {
+			for (int v = 0; v < n; v++) {
+				Word* from = visit + (long) v * words;
+				Word any = 0;
+
+				for (int w = 0; w < words; w++) {
+					any |= from[w] & active[w];
+				}
+
+				if (any == 0) {
+					continue;
+				}
+
+				for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+					Word* to = next + (long) csr->outTargets[a] * words;
+
+					for (int w = 0; w < words; w++) {
+						to[w] |= from[w] & active[w];
+					}
+				}
+			}
+
+			bool advanced = false;
+
+			for (int v = 0; v < n; v++) {
+				long base = (long) v * words;
+
+				for (int w = 0; w < words; w++) {
+					Word fresh = next[base + w] & ~seen[base + w];
+
+					next[base + w] = 0;
+					visit[base + w] = fresh;
+					seen[base + w] |= fresh;
+
+					while (fresh != 0) {
+						int i = w * WORD_BITS + __builtin_ctzl(fresh);
+
+						scratch.reached[i]++;
+						scratch.distanceSum[i] += level;
+						scratch.harmonicSum[i] += 1.0 / level;
+						fresh &= fresh - 1;
+						advanced = true;
+					}
+				}
+			}
+
+			if (!advanced) {
+				break;
+			}
+
+			if (topK > 0 && !prune(count, measure, level, scratch)) {
+				break;
+			}
+		}
+
+		finishBatch(sources, count, measure, scratch);
+	}
+
+	/**
+	 * Drops the sources which cannot make it into the top k. Returns
+	 * whether any source is left.
+	 */
+	bool prune(int count, Measure measure, int level, Scratch& scratch)
+	{
+		double current;
+		bool left = false;
+
+		#pragma omp critical (closenessTop)
+		current = threshold;
+
+		for (int i = 0; i < count; i++) {
+			Word bit = 1UL << (i % WORD_BITS);
+
+			if ((scratch.active[i / WORD_BITS] & bit) != 0
+				&& bound(measure, scratch.reached[i], scratch.distanceSum[i],
+					scratch.harmonicSum[i], level) < current)
+			{
+				scratch.active[i / WORD_BITS] &= ~bit;
+			}
+
+			left |= (scratch.active[i / WORD_BITS] & bit) != 0;
+		}
+
+		return left;
+	}
+
+	void finishBatch(int* sources, int count, Measure measure, Scratch& scratch)
+	{
+		int n = csr->vertexCount;
+
+		for (int i = 0; i < count; i++) {
+			int v = sources[i];
+			double c = closenessOf(scratch.reached[i], scratch.distanceSum[i]);
+			double h = n > 1 ? scratch.harmonicSum[i] / (n - 1) : 0.0;
+
+			if (topK == 0) {
+				closeness[v] = c;
+				harmonic[v] = h;
+				continue;
+			}
+
+			if ((scratch.active[i / WORD_BITS] & (1UL << (i % WORD_BITS))) == 0) {
+				continue;
+			}
+
+			#pragma omp critical (closenessTop)
+			{
+				offer(Entry(measure == CLOSENESS ? c : h, v));
+			}
+		}
+	}
+
+	void offer(Entry entry)
+	{
+		if ((int) top.size() < topK) {
+			top.push_back(entry);
+			push_heap(top.begin(), top.end(), greater<Entry>());
+		} else if (entry > top.front()) {
+			pop_heap(top.begin(), top.end(), greater<Entry>());
+			top.back() = entry;
+			push_heap(top.begin(), top.end(), greater<Entry>());
+		}
+
+		if ((int) top.size() == topK) {
+			threshold = top.front().first;
+		}
+	}
+};
+
+#endif /* CLOSENESSCENTRALITY_H_ */
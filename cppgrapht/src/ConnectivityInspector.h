@@ -0,0 +1,388 @@
+#ifndef CONNECTIVITYINSPECTOR_H_
+#define CONNECTIVITYINSPECTOR_H_
+
+#include <list>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * Computes the connected components of a graph. Directed graphs are treated
+ * as undirected, so their weakly connected components are found.
+ *
+ * <p>The components are found with a concurrent union-find on a {@link
+ * CSRGraph} snapshot, following the Afforest algorithm (Sutton, Ben-Nun and
+ * Barak, "Optimizing Parallel Graph Connectivity Computation via Subgraph
+ * Sampling", 2018):</p>
+ *
+ * <ol>
+ * <li>every vertex is linked with its first <code>NEIGHBOR_ROUNDS</code>
+ * neighbors, which usually already forms the giant component;</li>
+ * <li>the largest intermediate component is estimated from a sample of
+ * vertices;</li>
+ * <li>only the vertices outside of that component link their remaining
+ * neighbors. Edges between two vertices of the giant component are never
+ * looked at again.</li>
+ * </ol>
+ *
+ * <p>Every tree of the union-find points from higher to lower vertex ids, so
+ * links are single compare-and-swap operations on the root and concurrent
+ * links need no locks. Paths are shortened by pointer jumping between the
+ * phases. All loops over the vertices run in parallel when compiled with
+ * OpenMP.</p>
+ *
+ * <p>Finally the roots are renumbered densely by a parallel compaction, so
+ * the component ids run from <code>0</code> to {@link #getComponentCount}
+ * <code>- 1</code>, in order of the smallest vertex id of each
+ * component.</p>
+ *
+ * <p>The result is a snapshot; it is not updated when the graph changes.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class ConnectivityInspector
+{
+public:
+	static const int NEIGHBOR_ROUNDS = 2;
+	static const int SAMPLE_SIZE = 1024;
+
+	/**
+	 * Vertices per chunk of the compaction.
+	 */
+	static const int CHUNK_SIZE = 4096;
+
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * Component id of every vertex, indexed by the vertex ids of the
+	 * snapshot.
+	 */
+	vector<int> component;
+
+	/**
+	 * Number of vertices of every component.
+	 */
+	vector<int> componentSizes;
+
+	/**
+	 * Computes the connected components of the specified graph.
+	 *
+	 * @param g the graph to inspect
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	ConnectivityInspector(Graph<V, E>* g)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+		ownsSnapshot = true;
+
+		run();
+	}
+
+	/**
+	 * Computes the connected components of an existing undirected snapshot,
+	 * which is neither copied nor deleted.
+	 *
+	 * @param snapshot undirected snapshot of the graph to inspect
+	 *
+	 * @throws invalid_argument if the snapshot is directed.
+	 */
+	ConnectivityInspector(CSRGraph<V, E>* snapshot)
+	{
+		if (snapshot->directed) {
+			throw new invalid_argument("Snapshot must be undirected");
+		}
+
+		graph = snapshot->graph;
+		csr = snapshot;
+		ownsSnapshot = false;
+
+		run();
+	}
+
+	virtual ~ConnectivityInspector()
+	{
+		if (ownsSnapshot) {
+			delete csr;
+		}
+	}
+
+	/**
+	 * Returns the number of connected components.
+	 *
+	 * @return the number of components
+	 */
+	int getComponentCount()
+	{
+		return componentSizes.size();
+	}
+
+	/**
+	 * Returns whether the graph is connected. The empty graph is not
+	 * connected.
+	 *
+	 * @return <code>true</code> if there is exactly one component.
+	 */
+	bool isGraphConnected()
+	{
+		return componentSizes.size() == 1;
+	}
+
+	/**
+	 * Returns the id of the component containing the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the component id
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	int getComponentOf(V* vertex)
+	{
+		return component[indexOf(vertex)];
+	}
+
+	/**
+	 * Returns whether there is a path between the two vertices, ignoring the
+	 * direction of the edges.
+	 *
+	 * @param sourceVertex one end of the path
+	 * @param targetVertex other end of the path
+	 *
+	 * @return <code>true</code> if both vertices share a component.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	bool pathExists(V* sourceVertex, V* targetVertex)
+	{
+		return getComponentOf(sourceVertex) == getComponentOf(targetVertex);
+	}
+
+	/**
+	 * Returns the vertices of the component containing the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return set of the vertices connected to the vertex
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	set<V*>* connectedSetOf(V* vertex)
+	{
+		int c = getComponentOf(vertex);
+		set<V*>* connectedSet = new set<V*>();
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			if (component[v] == c) {
+				connectedSet->insert(csr->vertices[v]);
+			}
+		}
+
+		return connectedSet;
+	}
+
+	/**
+	 * Returns the vertex sets of all components, in the order of their ids.
+	 *
+	 * @return list of the connected sets
+	 */
+	list<set<V*>*>* connectedSets()
+	{
+		vector<set<V*>*> sets(componentSizes.size());
+
+		for (int c = 0; c < (int) sets.size(); c++) {
+			sets[c] = new set<V*>();
+		}
+		for (int v = 0; v < csr->vertexCount; v++) {
+			sets[component[v]]->insert(csr->vertices[v]);
+		}
+
+		return new list<set<V*>*>(sets.begin(), sets.end());
+	}
+
+private:
+	bool ownsSnapshot;
+
+	void run()
+	{
+		int n = csr->vertexCount;
+		vector<int> parent(n);
+
+		#pragma omp parallel for schedule(static)
+		for (int v = 0; v < n; v++) {
+			parent[v] = v;
+		}
+
+		for (int r = 0; r < NEIGHBOR_ROUNDS; r++) {
+			#pragma omp parallel for schedule(dynamic, 16384)
+			for (int v = 0; v < n; v++) {
+				int a = csr->outOffsets[v] + r;
+
+				if (a < csr->outOffsets[v + 1]) {
+					link(&parent[0], v, csr->outTargets[a]);
+				}
+			}
+
+			compress(parent);
+		}
+
+		int giant = sampleFrequentRoot(parent);
+
+		#pragma omp parallel for schedule(dynamic, 16384)
+		for (int v = 0; v < n; v++) {
+			if (parent[v] == giant) {
+				continue;
+			}
+
+			for (int a = csr->outOffsets[v] + NEIGHBOR_ROUNDS;
+				a < csr->outOffsets[v + 1];
+				a++)
+			{
+				link(&parent[0], v, csr->outTargets[a]);
+			}
+		}
+
+		compress(parent);
+		compact(parent);
+	}
+
+	int indexOf(V* v)
+	{
+		int id = csr->indexOf(v);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return id;
+	}
+
+	/**
+	 * Merges the trees of two vertices by hooking the higher root under the
+	 * lower one. A failed compare-and-swap means another thread changed the
+	 * root in the meantime; the loop then retries from the new parents.
+	 */
+	static void link(int* parent, int u, int v)
+	{
+		int p1 = parent[u];
+		int p2 = parent[v];
+
+		while (p1 != p2) {
+			int high = p1 > p2 ? p1 : p2;
+			int low = p1 > p2 ? p2 : p1;
+			int highParent = parent[high];
+
+			if (highParent == low) {
+				return;
+			}
+			if (highParent == high
+				&& __sync_bool_compare_and_swap(&parent[high], high, low))
+			{
+				return;
+			}
+
+			p1 = parent[parent[high]];
+			p2 = parent[low];
+		}
+	}
+
+	/**
+	 * Points every vertex directly at its root.
+	 */
+	void compress(vector<int>& parent)
+	{
+		int n = csr->vertexCount;
+
+		#pragma omp parallel for schedule(dynamic, 16384)
+		for (int v = 0; v < n; v++) {
+			while (parent[v] != parent[parent[v]]) {
+				parent[v] = parent[parent[v]];
+			}
+		}
+	}
+
+	/**
+	 * Returns the root seen most often among a fixed pseudo-random sample of
+	 * vertices, or <code>-1</code> for the empty graph.
+	 */
+	int sampleFrequentRoot(vector<int>& parent)
+	{
+		int n = csr->vertexCount;
+		map<int, int> counts;
+		unsigned seed = 27491095;
+		int best = -1;
+
+		for (int i = 0; i < SAMPLE_SIZE && n > 0; i++) {
+			seed = seed * 1103515245u + 12345u;
+			int root = parent[(seed >> 8) % n];
+
+			if (++counts[root] > (best < 0 ? 0 : counts[best])) {
+				best = root;
+			}
+		}
+
+		return best;
+	}
+
+	/**
+	 * Numbers the roots in increasing order and labels every vertex with the
+	 * number of its root. Each chunk counts its roots, the chunk offsets are
+	 * summed up and each chunk then numbers its roots from its offset.
+	 */
+	void compact(vector<int>& parent)
+	{
+		int n = csr->vertexCount;
+		int chunks = (n + CHUNK_SIZE - 1) / CHUNK_SIZE;
+		vector<int> offsets(chunks + 1, 0);
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (int c = 0; c < chunks; c++) {
+			int end = (c + 1) * CHUNK_SIZE < n ? (c + 1) * CHUNK_SIZE : n;
+			int roots = 0;
+
+			for (int v = c * CHUNK_SIZE; v < end; v++) {
+				roots += parent[v] == v;
+			}
+
+			offsets[c + 1] = roots;
+		}
+
+		for (int c = 0; c < chunks; c++) {
+			offsets[c + 1] += offsets[c];
+		}
+
+		component.resize(n);
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (int c = 0; c < chunks; c++) {
+			int end = (c + 1) * CHUNK_SIZE < n ? (c + 1) * CHUNK_SIZE : n;
+			int id = offsets[c];
+
+			for (int v = c * CHUNK_SIZE; v < end; v++) {
+				if (parent[v] == v) {
+					component[v] = id++;
+				}
+			}
+		}
+
+		// every vertex points at its root, whose label is final
+		#pragma omp parallel for schedule(static)
+		for (int v = 0; v < n; v++) {
+			component[v] = component[parent[v]];
+		}
+
+		componentSizes.assign(offsets[chunks], 0);
+
+		for (int v = 0; v < n; v++) {
+			componentSizes[component[v]]++;
+		}
+	}
+};
+
+#endif /* CONNECTIVITYINSPECTOR_H_ */
@@ -0,0 +1,163 @@
+#ifndef CONNECTIVITYTRACKER_H_
+#define CONNECTIVITYTRACKER_H_
+
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Maintains the connected components of a growing graph with a union-find
+ * structure (union by size, path halving), so that connectivity queries take
+ * nearly constant time. Edge directions are ignored.
+ *
+ * <p>Union-find cannot split components. A removal therefore only marks the
+ * tracker as stale; the owner of the tracker rebuilds it from scratch before
+ * the next query (see {@link AbstractBaseGraph#connected}). As long as
+ * nothing is removed no rebuild ever happens.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V>
+class ConnectivityTracker
+{
+public:
+	map<V*, int> vertexIndex;
+	vector<V*> vertices;
+	vector<int> parent;
+	vector<int> size;
+	int componentCount;
+	bool stale;
+
+	ConnectivityTracker()
+	{
+		componentCount = 0;
+		stale = false;
+	}
+
+	/**
+	 * Forgets all vertices and marks the tracker as up to date, ready to be
+	 * refilled.
+	 */
+	void clear()
+	{
+		vertexIndex.clear();
+		vertices.clear();
+		parent.clear();
+		size.clear();
+		componentCount = 0;
+		stale = false;
+	}
+
+	/**
+	 * Marks the tracker as stale after a removal. Additions are ignored until
+	 * it has been cleared and refilled.
+	 */
+	void invalidate()
+	{
+		stale = true;
+	}
+
+	/**
+	 * Adds a vertex as a component by itself, unless it is known already.
+	 *
+	 * @param v the vertex
+	 */
+	void addVertex(V* v)
+	{
+		if (stale || vertexIndex.count(v) == 1) {
+			return;
+		}
+
+		vertexIndex[v] = vertices.size();
+		parent.push_back(vertices.size());
+		size.push_back(1);
+		vertices.push_back(v);
+		componentCount++;
+	}
+
+	/**
+	 * Merges the components of the end points of an edge.
+	 *
+	 * @param u one end point
+	 * @param v other end point
+	 */
+	void addEdge(V* u, V* v)
+	{
+		if (stale) {
+			return;
+		}
+
+		int a = find(indexOf(u));
+		int b = find(indexOf(v));
+
+		if (a == b) {
+			return;
+		}
+		if (size[a] < size[b]) {
+			int swap = a;
+			a = b;
+			b = swap;
+		}
+
+		parent[b] = a;
+		size[a] += size[b];
+		componentCount--;
+	}
+
+	/**
+	 * Returns whether the two vertices are connected.
+	 *
+	 * @param u first vertex
+	 * @param v second vertex
+	 *
+	 * @return <code>true</code> if both share a component.
+	 *
+	 * @throws invalid_argument if a vertex is unknown.
+	 */
+	bool connected(V* u, V* v)
+	{
+		return find(indexOf(u)) == find(indexOf(v));
+	}
+
+	/**
+	 * Returns the representative vertex of the component of a vertex. Two
+	 * vertices are connected if and only if their representatives are the
+	 * same; the representative changes when components merge.
+	 *
+	 * @param v the vertex
+	 *
+	 * @return the representative of the component
+	 *
+	 * @throws invalid_argument if the vertex is unknown.
+	 */
+	V* componentOf(V* v)
+	{
+		return vertices[find(indexOf(v))];
+	}
+
+private:
+	int indexOf(V* v)
+	{
+		typename map<V*, int>::iterator it = vertexIndex.find(v);
+
+		if (it == vertexIndex.end()) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return it->second;
+	}
+
+	int find(int v)
+	{
+		while (parent[v] != v) {
+			parent[v] = parent[parent[v]];
+			v = parent[v];
+		}
+
+		return v;
+	}
+};
+
+#endif /* CONNECTIVITYTRACKER_H_ */
@@ -0,0 +1,870 @@
+#ifndef CONTRACTIONHIERARCHY_H_
+#define CONTRACTIONHIERARCHY_H_
+
+#include <algorithm>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <list>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <GraphPath.h>
+#include <GraphPathImpl.h>
+#include <WeightedGraph.h>
+
+/**
+ * Point-to-point shortest paths with <a
+ * href="http://en.wikipedia.org/wiki/Contraction_hierarchies">contraction
+ * hierarchies</a> (Geisberger et al., "Contraction Hierarchies: Faster and
+ * Simpler Hierarchical Routing in Road Networks", WEA 2008).
+ *
+ * <p>Preprocessing contracts the vertices one by one in order of importance
+ * (edge difference plus number of contracted neighbors, kept up to date
+ * lazily). Contracting <code>v</code> inserts a shortcut <code>u -&gt;
+ * w</code> for every pair of neighbors whose shortest connection runs through
+ * <code>v</code>, which is decided by a witness search limited to
+ * <code>settleLimit</code> settled vertices; a failed witness search only
+ * costs a superfluous shortcut. The result is an overlay of two CSR graphs:
+ * the upward arcs leaving every vertex towards higher ranked vertices and the
+ * downward arcs entering it from them, stored reversed. A query runs a
+ * bidirectional Dijkstra search which only climbs the hierarchy and unpacks
+ * the shortcuts of the resulting path into the original edges.</p>
+ *
+ * <p>The graph is treated as directed if it implements {@link
+ * DirectedGraph}. Parallel edges are reduced to the lightest one and loops are
+ * ignored. All edge weights must be non-negative.</p>
+ *
+ * <p>The hierarchy refers to vertices and edges by dense ids. {@link #write}
+ * stores the overlay in the native byte order; the reading constructor needs
+ * the vertices and edges in the id order of the writing instance, see {@link
+ * #getVertices} and {@link #getEdges}. Queries share working arrays, so an
+ * instance must not be queried from several threads at once.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class ContractionHierarchy
+{
+public:
+	Graph<V, E>* graph;
+	int vertexCount;
+
+	vector<V*> vertices;
+	map<V*, int> vertexIndex;
+	vector<E*> edges;
+
+	/**
+	 * Position of every vertex in the contraction order.
+	 */
+	vector<int> rank;
+
+	/**
+	 * All arcs, original ones and shortcuts. An original arc refers to its
+	 * edge, a shortcut to the two arcs it bypasses.
+	 */
+	vector<int> arcTails;
+	vector<int> arcHeads;
+	vector<double> arcWeights;
+	vector<int> arcEdges;
+	vector<int> arcFirst;
+	vector<int> arcSecond;
+
+	vector<int> upOffsets;
+	vector<int> upHeads;
+	vector<double> upWeights;
+	vector<int> upArcs;
+
+	vector<int> downOffsets;
+	vector<int> downTails;
+	vector<double> downWeights;
+	vector<int> downArcs;
+
+	/**
+	 * Builds the hierarchy of the specified graph.
+	 *
+	 * @param graph the graph to preprocess
+	 * @param settleLimit the maximum number of vertices a witness search may
+	 * settle
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or has
+	 * negative edge weights.
+	 */
+	ContractionHierarchy(WeightedGraph<V, E>* graph, int settleLimit = 500)
+	{
+		CSRGraph<V, E> csr(graph);
+
+		if (csr.hasNegativeEdgeWeight()) {
+			throw new invalid_argument(
+				"Contraction hierarchies require non-negative edge weights");
+		}
+
+		this->graph = graph;
+		vertexCount = csr.vertexCount;
+		vertices = csr.vertices;
+		vertexIndex = csr.vertexIndex;
+		edges = csr.edges;
+
+		Contractor contractor(this, &csr, settleLimit);
+		contractor.run();
+
+		buildOverlay(contractor.overlayArcs);
+		initQuery();
+	}
+
+	/**
+	 * Reads a hierarchy previously stored with {@link #write}.
+	 *
+	 * @param graph the graph the hierarchy belongs to
+	 * @param vertices the vertices in the order of {@link #getVertices} of the
+	 * writing instance
+	 * @param edges the edges in the order of {@link #getEdges} of the writing
+	 * instance
+	 * @param in the stream to read from
+	 *
+	 * @throws invalid_argument if the stream is truncated or malformed or
+	 * does not match the vertex and edge counts.
+	 */
+	ContractionHierarchy(
+		Graph<V, E>* graph,
+		vector<V*>* vertices,
+		vector<E*>* edges,
+		istream& in)
+	{
+		this->graph = graph;
+		this->vertices = *vertices;
+		this->edges = *edges;
+		vertexCount = vertices->size();
+
+		for (int v = 0; v < vertexCount; v++) {
+			vertexIndex.insert(pair<V*, int>(this->vertices[v], v));
+		}
+
+		int header[3];
+		readArray(in, header, 3);
+		if (header[0] != MAGIC || header[1] != vertexCount
+			|| header[2] != (int) edges->size())
+		{
+			throw new invalid_argument("Contraction hierarchy does not match the graph");
+		}
+
+		read(in, rank);
+		read(in, arcTails);
+		read(in, arcHeads);
+		read(in, arcWeights);
+		read(in, arcEdges);
+		read(in, arcFirst);
+		read(in, arcSecond);
+		read(in, upOffsets);
+		read(in, upHeads);
+		read(in, upWeights);
+		read(in, upArcs);
+		read(in, downOffsets);
+		read(in, downTails);
+		read(in, downWeights);
+		read(in, downArcs);
+
+		validate();
+		initQuery();
+	}
+
+	/**
+	 * Writes the hierarchy to the specified stream.
+	 *
+	 * @param out the stream to write to
+	 *
+	 * @throws runtime_error if writing fails.
+	 */
+	void write(ostream& out)
+	{
+		int header[3] = { MAGIC, vertexCount, (int) edges.size() };
+		writeArray(out, header, 3);
+
+		write(out, rank);
+		write(out, arcTails);
+		write(out, arcHeads);
+		write(out, arcWeights);
+		write(out, arcEdges);
+		write(out, arcFirst);
+		write(out, arcSecond);
+		write(out, upOffsets);
+		write(out, upHeads);
+		write(out, upWeights);
+		write(out, upArcs);
+		write(out, downOffsets);
+		write(out, downTails);
+		write(out, downWeights);
+		write(out, downArcs);
+
+		if (!out) {
+			throw new runtime_error("Writing the contraction hierarchy failed");
+		}
+	}
+
+	/**
+	 * Returns the vertices, indexed by their id in this hierarchy.
+	 *
+	 * @return the vertices in id order
+	 */
+	const vector<V*>* getVertices()
+	{
+		return &vertices;
+	}
+
+	/**
+	 * Returns the edges, indexed by their id in this hierarchy.
+	 *
+	 * @return the edges in id order
+	 */
+	const vector<E*>* getEdges()
+	{
+		return &edges;
+	}
+
+	/**
+	 * Returns the length of the shortest path from the source vertex to the
+	 * target vertex.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return the length of the path, or infinity if no path exists.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	double getPathLength(V* sourceVertex, V* targetVertex)
+	{
+		query(indexOf(sourceVertex), indexOf(targetVertex));
+
+		return best;
+	}
+
+	/**
+	 * Calculates (and returns) the shortest path from the source vertex to
+	 * the target vertex, with all shortcuts unpacked.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return the shortest path, or <code>NULL</code> if no path exists.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	GraphPath<V, E>* getShortestPath(V* sourceVertex, V* targetVertex)
+	{
+		int s = indexOf(sourceVertex);
+		int t = indexOf(targetVertex);
+
+		query(s, t);
+
+		if (meeting < 0) {
+			return NULL;
+		}
+
+		list<E*>* edgeList = new list<E*>();
+
+		for (int v = meeting; v != s; v = arcTails[forwardArc[v]]) {
+			unpack(forwardArc[v], edgeList, true);
+		}
+		for (int v = meeting; v != t; v = arcHeads[backwardArc[v]]) {
+			unpack(backwardArc[v], edgeList, false);
+		}
+
+		return new GraphPathImpl<V, E>(
+			graph, sourceVertex, targetVertex, edgeList, best);
+	}
+
+	/**
+	 * Returns the number of shortcuts inserted by the preprocessing.
+	 *
+	 * @return the number of shortcuts
+	 */
+	int getShortcutCount()
+	{
+		int count = 0;
+
+		for (int i = 0; i < (int) upArcs.size(); i++) {
+			count += arcEdges[upArcs[i]] < 0 ? 1 : 0;
+		}
+		for (int i = 0; i < (int) downArcs.size(); i++) {
+			count += arcEdges[downArcs[i]] < 0 ? 1 : 0;
+		}
+
+		return count;
+	}
+
+private:
+	static const int MAGIC = 0x48430001;
+
+	typedef pair<double, int> Entry;
+
+	vector<double> forwardDistance;
+	vector<double> backwardDistance;
+	vector<int> forwardArc;
+	vector<int> backwardArc;
+	vector<unsigned int> forwardStamp;
+	vector<unsigned int> backwardStamp;
+	unsigned int stamp;
+	vector<Entry> forwardHeap;
+	vector<Entry> backwardHeap;
+	double best;
+	int meeting;
+
+	/**
+	 * The preprocessing state: a dynamic graph of the not yet contracted
+	 * vertices and the queue of vertex priorities.
+	 */
+	class Contractor
+	{
+	public:
+		ContractionHierarchy<V, E>* ch;
+		int n;
+		int settleLimit;
+
+		vector<vector<int> > outArcs;
+		vector<vector<int> > inArcs;
+		vector<bool> contracted;
+		vector<int> contractedNeighbors;
+		vector<int> overlayArcs;
+
+		vector<double> witnessDistance;
+		vector<unsigned int> witnessStamp;
+		unsigned int stamp;
+		vector<Entry> heap;
+
+		Contractor(ContractionHierarchy<V, E>* ch, CSRGraph<V, E>* csr, int settleLimit)
+		{
+			this->ch = ch;
+			this->n = csr->vertexCount;
+			this->settleLimit = settleLimit;
+
+			outArcs.resize(n);
+			inArcs.resize(n);
+			contracted.assign(n, false);
+			contractedNeighbors.assign(n, 0);
+			witnessDistance.resize(n);
+			witnessStamp.assign(n, 0);
+			stamp = 0;
+
+			for (int e = 0; e < csr->edgeCount; e++) {
+				int u = csr->edgeSources[e];
+				int w = csr->edgeTargets[e];
+
+				addArc(u, w, csr->edgeWeights[e], e, -1, -1);
+				if (!csr->directed) {
+					addArc(w, u, csr->edgeWeights[e], e, -1, -1);
+				}
+			}
+		}
+
+		void run()
+		{
+			vector<Entry> queue;
+
+			for (int v = 0; v < n; v++) {
+				queue.push_back(Entry(priority(v), v));
+			}
+			make_heap(queue.begin(), queue.end(), greater<Entry>());
+
+			ch->rank.assign(n, 0);
+			int next = 0;
+
+			while (!queue.empty()) {
+				pop_heap(queue.begin(), queue.end(), greater<Entry>());
+				int v = queue.back().second;
+				queue.pop_back();
+
+				// lazy update: requeue if the priority got worse meanwhile
+				double p = priority(v);
+				if (!queue.empty() && p > queue.front().first) {
+					queue.push_back(Entry(p, v));
+					push_heap(queue.begin(), queue.end(), greater<Entry>());
+					continue;
+				}
+
+				ch->rank[v] = next++;
+				contract(v, false);
+			}
+		}
+
+		/**
+		 * Adds an arc, keeping only the lightest arc between two vertices.
+		 */
+		void addArc(int u, int w, double weight, int edge, int first, int second)
+		{
+			if (u == w) {
+				return;
+			}
+
+			for (int i = 0; i < (int) outArcs[u].size(); i++) {
+				int a = outArcs[u][i];
+
+				if (ch->arcHeads[a] == w) {
+					if (ch->arcWeights[a] <= weight) {
+						return;
+					}
+
+					outArcs[u].erase(outArcs[u].begin() + i);
+					removeFrom(inArcs[w], a);
+					break;
+				}
+			}
+
+			int id = ch->arcTails.size();
+			ch->arcTails.push_back(u);
+			ch->arcHeads.push_back(w);
+			ch->arcWeights.push_back(weight);
+			ch->arcEdges.push_back(edge);
+			ch->arcFirst.push_back(first);
+			ch->arcSecond.push_back(second);
+
+			outArcs[u].push_back(id);
+			inArcs[w].push_back(id);
+		}
+
+		static void removeFrom(vector<int>& arcs, int a)
+		{
+			arcs.erase(find(arcs.begin(), arcs.end(), a));
+		}
+
+		double priority(int v)
+		{
+			int shortcuts = contract(v, true);
+			int removed = inArcs[v].size() + outArcs[v].size();
+
+			return (shortcuts - removed) + contractedNeighbors[v];
+		}
+
+		/**
+		 * Contracts the vertex or, when simulating, only counts the
+		 * shortcuts its contraction would need.
+		 */
+		int contract(int v, bool simulate)
+		{
+			int shortcuts = 0;
+			vector<int> in = inArcs[v];
+			vector<int> out = outArcs[v];
+
+			for (int i = 0; i < (int) in.size(); i++) {
+				int a = in[i];
+				int u = ch->arcTails[a];
+				double maxWeight = 0.0;
+
+				for (int j = 0; j < (int) out.size(); j++) {
+					maxWeight = max(maxWeight, ch->arcWeights[a] + ch->arcWeights[out[j]]);
+				}
+
+				witnessSearch(u, v, maxWeight);
+
+				for (int j = 0; j < (int) out.size(); j++) {
+					int b = out[j];
+					int w = ch->arcHeads[b];
+					double weight = ch->arcWeights[a] + ch->arcWeights[b];
+
+					if (w == u
+						|| (witnessStamp[w] == stamp && witnessDistance[w] <= weight))
+					{
+						continue;
+					}
+
+					shortcuts++;
+					if (!simulate) {
+						addArc(u, w, weight, -1, a, b);
+					}
+				}
+			}
+
+			if (!simulate) {
+				contracted[v] = true;
+
+				for (int i = 0; i < (int) inArcs[v].size(); i++) {
+					int a = inArcs[v][i];
+					int u = ch->arcTails[a];
+
+					removeFrom(outArcs[u], a);
+					contractedNeighbors[u]++;
+					overlayArcs.push_back(a);
+				}
+				for (int i = 0; i < (int) outArcs[v].size(); i++) {
+					int b = outArcs[v][i];
+					int w = ch->arcHeads[b];
+
+					removeFrom(inArcs[w], b);
+					contractedNeighbors[w]++;
+					overlayArcs.push_back(b);
+				}
+
+				inArcs[v].clear();
+				outArcs[v].clear();
+			}
+
+			return shortcuts;
+		}
+
+		/**
+		 * Dijkstra search from <code>u</code> avoiding <code>v</code>, bounded
+		 * by distance and number of settled vertices.
+		 */
+		void witnessSearch(int u, int v, double maxWeight)
+		{
+			if (++stamp == 0) {
+				witnessStamp.assign(n, 0);
+				stamp = 1;
+			}
+
+			heap.clear();
+			witnessStamp[u] = stamp;
+			witnessDistance[u] = 0.0;
+			heap.push_back(Entry(0.0, u));
+
+			int settled = 0;
+
+			while (!heap.empty() && settled < settleLimit) {
+				pop_heap(heap.begin(), heap.end(), greater<Entry>());
+				Entry top = heap.back();
+				heap.pop_back();
+
+				int x = top.second;
+				if (top.first > witnessDistance[x]) {
+					continue;
+				}
+				if (top.first > maxWeight) {
+					break;
+				}
+				settled++;
+
+				for (int i = 0; i < (int) outArcs[x].size(); i++) {
+					int a = outArcs[x][i];
+					int y = ch->arcHeads[a];
+					double d = top.first + ch->arcWeights[a];
+
+					if (y == v) {
+						continue;
+					}
+					if (witnessStamp[y] != stamp || d < witnessDistance[y]) {
+						witnessStamp[y] = stamp;
+						witnessDistance[y] = d;
+						heap.push_back(Entry(d, y));
+						push_heap(heap.begin(), heap.end(), greater<Entry>());
+					}
+				}
+			}
+		}
+	};
+
+	/**
+	 * Sorts the arcs collected during the contraction into the upward and
+	 * downward graphs of their lower ranked endpoint.
+	 */
+	void buildOverlay(const vector<int>& overlayArcs)
+	{
+		vector<int> upTails, downHeads, upIds, downIds;
+		vector<int> upArcHeads, downArcTails;
+		vector<double> upArcWeights, downArcWeights;
+
+		for (int i = 0; i < (int) overlayArcs.size(); i++) {
+			int a = overlayArcs[i];
+			int u = arcTails[a];
+			int w = arcHeads[a];
+
+			if (rank[u] < rank[w]) {
+				upTails.push_back(u);
+				upArcHeads.push_back(w);
+				upArcWeights.push_back(arcWeights[a]);
+				upIds.push_back(a);
+			} else {
+				downHeads.push_back(w);
+				downArcTails.push_back(u);
+				downArcWeights.push_back(arcWeights[a]);
+				downIds.push_back(a);
+			}
+		}
+
+		CSRGraph<V, E>::buildRows(vertexCount, upTails, upArcHeads,
+			upArcWeights, upIds, upOffsets, upHeads, upWeights, upArcs);
+		CSRGraph<V, E>::buildRows(vertexCount, downHeads, downArcTails,
+			downArcWeights, downIds, downOffsets, downTails, downWeights, downArcs);
+	}
+
+	/**
+	 * Checks a hierarchy read from a stream, so that no query indexes out of
+	 * bounds or runs forever: every id lies in its range, a shortcut only
+	 * refers to arcs created before it, and the rows of the overlay graphs
+	 * hold the arcs they claim to, leading to vertices of higher rank with
+	 * non-negative weights.
+	 */
+	void validate()
+	{
+		int arcCount = arcTails.size();
+		int edgeCount = edges.size();
+		bool valid = (int) rank.size() == vertexCount
+			&& (int) arcHeads.size() == arcCount
+			&& (int) arcWeights.size() == arcCount
+			&& (int) arcEdges.size() == arcCount
+			&& (int) arcFirst.size() == arcCount
+			&& (int) arcSecond.size() == arcCount;
+
+		for (int a = 0; valid && a < arcCount; a++) {
+			valid = arcTails[a] >= 0 && arcTails[a] < vertexCount
+				&& arcHeads[a] >= 0 && arcHeads[a] < vertexCount
+				&& arcEdges[a] < edgeCount
+				&& (arcEdges[a] >= 0
+					|| (arcFirst[a] >= 0 && arcFirst[a] < a
+						&& arcSecond[a] >= 0 && arcSecond[a] < a));
+		}
+
+		if (!valid
+			|| !isOverlay(upOffsets, upHeads, upWeights, upArcs, true)
+			|| !isOverlay(downOffsets, downTails, downWeights, downArcs, false))
+		{
+			throw new invalid_argument("Malformed contraction hierarchy");
+		}
+	}
+
+	/**
+	 * Returns whether the arrays form the rows of the upward or downward
+	 * graph: the row of <code>v</code> holds arcs leaving it, or entering it
+	 * for the downward graph, whose other end is <code>v</code> itself or of
+	 * higher rank.
+	 */
+	bool isOverlay(
+		const vector<int>& offsets,
+		const vector<int>& ends,
+		const vector<double>& weights,
+		const vector<int>& arcs,
+		bool upward)
+	{
+		int size = ends.size();
+
+		if ((int) offsets.size() != vertexCount + 1 || offsets[0] != 0
+			|| offsets[vertexCount] != size
+			|| (int) weights.size() != size || (int) arcs.size() != size)
+		{
+			return false;
+		}
+
+		for (int v = 0; v < vertexCount; v++) {
+			if (offsets[v] > offsets[v + 1]) {
+				return false;
+			}
+		}
+
+		for (int v = 0; v < vertexCount; v++) {
+			for (int i = offsets[v]; i < offsets[v + 1]; i++) {
+				int w = ends[i];
+				int a = arcs[i];
+
+				if (w < 0 || w >= vertexCount || a < 0 || a >= (int) arcTails.size()
+					|| !(weights[i] >= 0.0)
+					|| (upward ? arcTails[a] != v || arcHeads[a] != w
+						: arcHeads[a] != v || arcTails[a] != w)
+					|| (w != v && rank[v] >= rank[w]))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void initQuery()
+	{
+		forwardDistance.resize(vertexCount);
+		backwardDistance.resize(vertexCount);
+		forwardArc.resize(vertexCount);
+		backwardArc.resize(vertexCount);
+		forwardStamp.assign(vertexCount, 0);
+		backwardStamp.assign(vertexCount, 0);
+		stamp = 0;
+	}
+
+	int indexOf(V* v)
+	{
+		typename map<V*, int>::iterator it = vertexIndex.find(v);
+
+		if (it == vertexIndex.end()) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return it->second;
+	}
+
+	/**
+	 * Bidirectional upward search; leaves the distance in <code>best</code>
+	 * and the vertex where both searches meet in <code>meeting</code>.
+	 */
+	void query(int s, int t)
+	{
+		if (++stamp == 0) {
+			forwardStamp.assign(vertexCount, 0);
+			backwardStamp.assign(vertexCount, 0);
+			stamp = 1;
+		}
+
+		best = numeric_limits<double>::infinity();
+		meeting = -1;
+		forwardHeap.clear();
+		backwardHeap.clear();
+
+		forwardStamp[s] = stamp;
+		forwardDistance[s] = 0.0;
+		forwardArc[s] = -1;
+		forwardHeap.push_back(Entry(0.0, s));
+
+		backwardStamp[t] = stamp;
+		backwardDistance[t] = 0.0;
+		backwardArc[t] = -1;
+		backwardHeap.push_back(Entry(0.0, t));
+
+		bool forward = true;
+
+		while (true) {
+			bool forwardDone = forwardHeap.empty() || forwardHeap.front().first >= best;
+			bool backwardDone = backwardHeap.empty() || backwardHeap.front().first >= best;
+
+			if (forwardDone && backwardDone) {
+				break;
+			}
+			if (forwardDone) {
+				forward = false;
+			} else if (backwardDone) {
+				forward = true;
+			}
+
+			if (forward) {
+				step(forwardHeap, forwardDistance, forwardArc, forwardStamp,
+					backwardDistance, backwardStamp,
+					upOffsets, upHeads, upWeights, upArcs);
+			} else {
+				step(backwardHeap, backwardDistance, backwardArc, backwardStamp,
+					forwardDistance, forwardStamp,
+					downOffsets, downTails, downWeights, downArcs);
+			}
+
+			forward = !forward;
+		}
+	}
+
+	void step(
+		vector<Entry>& heap,
+		vector<double>& distance,
+		vector<int>& arc,
+		vector<unsigned int>& reached,
+		vector<double>& otherDistance,
+		vector<unsigned int>& otherReached,
+		const vector<int>& offsets,
+		const vector<int>& heads,
+		const vector<double>& weights,
+		const vector<int>& arcs)
+	{
+		pop_heap(heap.begin(), heap.end(), greater<Entry>());
+		Entry top = heap.back();
+		heap.pop_back();
+
+		int v = top.second;
+		if (top.first > distance[v]) {
+			return;
+		}
+
+		if (otherReached[v] == stamp && top.first + otherDistance[v] < best) {
+			best = top.first + otherDistance[v];
+			meeting = v;
+		}
+
+		for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+			int w = heads[a];
+			double d = top.first + weights[a];
+
+			if (reached[w] != stamp || d < distance[w]) {
+				reached[w] = stamp;
+				distance[w] = d;
+				arc[w] = arcs[a];
+				heap.push_back(Entry(d, w));
+				push_heap(heap.begin(), heap.end(), greater<Entry>());
+			}
+		}
+	}
+
+	/**
+	 * Appends the original edges of the arc to the path, at its front when
+	 * walking the forward half backwards from the meeting vertex.
+	 */
+	void unpack(int arc, list<E*>* edgeList, bool front)
+	{
+		vector<int> stack;
+		stack.push_back(arc);
+
+		while (!stack.empty()) {
+			int a = stack.back();
+			stack.pop_back();
+
+			if (arcEdges[a] >= 0) {
+				if (front) {
+					edgeList->push_front(edges[arcEdges[a]]);
+				} else {
+					edgeList->push_back(edges[arcEdges[a]]);
+				}
+			} else if (front) {
+				stack.push_back(arcFirst[a]);
+				stack.push_back(arcSecond[a]);
+			} else {
+				stack.push_back(arcSecond[a]);
+				stack.push_back(arcFirst[a]);
+			}
+		}
+	}
+
+	template <class T>
+	static void writeArray(ostream& out, const T* data, int size)
+	{
+		out.write((const char*) data, (long) size * sizeof(T));
+	}
+
+	template <class T>
+	static void write(ostream& out, const vector<T>& data)
+	{
+		int size = data.size();
+		writeArray(out, &size, 1);
+		if (size > 0) {
+			writeArray(out, &data[0], size);
+		}
+	}
+
+	template <class T>
+	static void readArray(istream& in, T* data, int size)
+	{
+		in.read((char*) data, (long) size * sizeof(T));
+
+		if (!in) {
+			throw new invalid_argument("Unexpected end of contraction hierarchy");
+		}
+	}
+
+	template <class T>
+	static void read(istream& in, vector<T>& data)
+	{
+		int size;
+		readArray(in, &size, 1);
+
+		if (size < 0) {
+			throw new invalid_argument("Malformed contraction hierarchy");
+		}
+
+		// grow the array while reading, so that a corrupt size fails at the
+		// end of the stream instead of allocating it at once
+		const int chunk = 65536;
+
+		data.clear();
+		for (int done = 0; done < size; done += chunk) {
+			int count = size - done < chunk ? size - done : chunk;
+
+			data.resize(done + count);
+			readArray(in, &data[done], count);
+		}
+	}
+};
+
+#endif /* CONTRACTIONHIERARCHY_H_ */
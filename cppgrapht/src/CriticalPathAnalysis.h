@@ -0,0 +1,326 @@
+#ifndef CRITICALPATHANALYSIS_H_
+#define CRITICALPATHANALYSIS_H_
+
+#include <cmath>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <GraphPath.h>
+#include <GraphPathImpl.h>
+#include <WeightedGraph.h>
+
+/**
+ * Critical path analysis of a weighted directed acyclic graph, such as a
+ * build or job schedule. The vertices are events and every edge is an
+ * activity taking its weight in time. For every vertex the analysis gives
+ *
+ * <ul>
+ * <li>the earliest start, the length of the longest path ending in it;</li>
+ * <li>the latest start which does not delay the whole schedule, the project
+ * length minus the longest path starting in it;</li>
+ * <li>the slack, the difference of both. Vertices without slack are
+ * critical.</li>
+ * </ul>
+ *
+ * <p>The vertices are first grouped into topological levels: the sources
+ * form level 0, and every other vertex lies one level behind its deepest
+ * predecessor. The vertices of a level do not depend on each other, so both
+ * passes handle a whole level at a time in parallel when compiled with
+ * OpenMP, the forward pass pulling from the predecessors and the backward
+ * pass from the successors. The levels themselves are found by Kahn's
+ * algorithm, expanding each level in parallel.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class CriticalPathAnalysis
+{
+public:
+	WeightedGraph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * The vertices of level <code>l</code> are <code>levelVertices[
+	 * levelOffsets[l]]</code> up to (excluding) <code>levelVertices[
+	 * levelOffsets[l + 1]]</code>.
+	 */
+	vector<int> levelOffsets;
+	vector<int> levelVertices;
+
+	vector<double> earliest;
+	vector<double> latest;
+
+	/**
+	 * Edge id of an incoming edge realizing the earliest start of every
+	 * vertex, or <code>-1</code> for the sources.
+	 */
+	vector<int> criticalEdge;
+
+	double projectLength;
+
+	/**
+	 * Analyzes the specified graph.
+	 *
+	 * @param graph the directed acyclic graph to analyze
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or contains
+	 * a cycle.
+	 */
+	CriticalPathAnalysis(WeightedGraph<V, E>* graph)
+	{
+		this->graph = graph;
+		csr = new CSRGraph<V, E>(graph, true);
+
+		if (!buildLevels()) {
+			delete csr;
+			throw new invalid_argument("Graph contains a cycle");
+		}
+
+		forwardPass();
+		backwardPass();
+	}
+
+	virtual ~CriticalPathAnalysis()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Returns the length of the whole schedule, the length of the longest
+	 * path.
+	 *
+	 * @return the project length
+	 */
+	double getProjectLength()
+	{
+		return projectLength;
+	}
+
+	/**
+	 * Returns the earliest start of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the earliest start
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	double getEarliestStart(V* vertex)
+	{
+		return earliest[indexOf(vertex)];
+	}
+
+	/**
+	 * Returns the latest start of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the latest start
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	double getLatestStart(V* vertex)
+	{
+		return latest[indexOf(vertex)];
+	}
+
+	/**
+	 * Returns the slack of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the latest minus the earliest start
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	double getSlack(V* vertex)
+	{
+		int v = indexOf(vertex);
+
+		return latest[v] - earliest[v];
+	}
+
+	/**
+	 * Returns whether the specified vertex has no slack, up to rounding.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return <code>true</code> if the vertex is critical.
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	bool isCritical(V* vertex)
+	{
+		return getSlack(vertex) <= 1e-9 * fabs(projectLength);
+	}
+
+	/**
+	 * Returns a critical path, a longest path of the graph.
+	 *
+	 * @return the critical path, or <code>NULL</code> for the empty graph.
+	 */
+	GraphPath<V, E>* getCriticalPath()
+	{
+		int end = -1;
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			if (end < 0 || earliest[v] > earliest[end]) {
+				end = v;
+			}
+		}
+
+		if (end < 0) {
+			return NULL;
+		}
+
+		list<E*>* edgeList = new list<E*>();
+		int v = end;
+
+		while (criticalEdge[v] >= 0) {
+			edgeList->push_front(csr->edges[criticalEdge[v]]);
+			v = csr->edgeSources[criticalEdge[v]];
+		}
+
+		return new GraphPathImpl<V, E>(
+			graph, csr->vertices[v], csr->vertices[end], edgeList,
+			earliest[end]);
+	}
+
+	/**
+	 * Returns the number of topological levels, the number of vertices on a
+	 * path with the most edges.
+	 *
+	 * @return the number of levels
+	 */
+	int getLevelCount()
+	{
+		return levelOffsets.size() - 1;
+	}
+
+private:
+	int indexOf(V* v)
+	{
+		int id = csr->indexOf(v);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return id;
+	}
+
+	/**
+	 * Kahn's algorithm, one level at a time. Returns <code>false</code> if
+	 * some vertices are never reached, which means there is a cycle.
+	 */
+	bool buildLevels()
+	{
+		int n = csr->vertexCount;
+		vector<int> inDegree(n);
+
+		for (int v = 0; v < n; v++) {
+			inDegree[v] = csr->inDegreeOf(v);
+
+			if (inDegree[v] == 0) {
+				levelVertices.push_back(v);
+			}
+		}
+
+		levelOffsets.push_back(0);
+
+		for (int begin = 0; begin < (int) levelVertices.size();) {
+			int end = levelVertices.size();
+			vector<int> next;
+
+			levelOffsets.push_back(end);
+
+			#pragma omp parallel
+			{
+				vector<int> local;
+
+				#pragma omp for schedule(dynamic, 256) nowait
+				for (int i = begin; i < end; i++) {
+					int v = levelVertices[i];
+
+					for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+						if (__sync_sub_and_fetch(&inDegree[csr->outTargets[a]], 1) == 0) {
+							local.push_back(csr->outTargets[a]);
+						}
+					}
+				}
+
+				#pragma omp critical
+				{
+					next.insert(next.end(), local.begin(), local.end());
+				}
+			}
+
+			// appended only after the region, as a reallocation would pull
+			// the level from under threads still reading it
+			levelVertices.insert(levelVertices.end(), next.begin(), next.end());
+			begin = end;
+		}
+
+		return (int) levelVertices.size() == n;
+	}
+
+	void forwardPass()
+	{
+		int n = csr->vertexCount;
+		earliest.assign(n, 0.0);
+		criticalEdge.assign(n, -1);
+		projectLength = 0.0;
+
+		for (int l = 1; l < getLevelCount(); l++) {
+			#pragma omp parallel for schedule(dynamic, 256)
+			for (int i = levelOffsets[l]; i < levelOffsets[l + 1]; i++) {
+				int v = levelVertices[i];
+				double best = -numeric_limits<double>::infinity();
+
+				for (int a = csr->inOffsets[v]; a < csr->inOffsets[v + 1]; a++) {
+					double start = earliest[csr->inSources[a]] + csr->inWeights[a];
+
+					if (start > best) {
+						best = start;
+						criticalEdge[v] = csr->inEdgeIds[a];
+					}
+				}
+
+				earliest[v] = best;
+			}
+		}
+
+		for (int v = 0; v < n; v++) {
+			if (earliest[v] > projectLength) {
+				projectLength = earliest[v];
+			}
+		}
+	}
+
+	void backwardPass()
+	{
+		latest.assign(csr->vertexCount, projectLength);
+
+		for (int l = getLevelCount() - 1; l >= 0; l--) {
+			#pragma omp parallel for schedule(dynamic, 256)
+			for (int i = levelOffsets[l]; i < levelOffsets[l + 1]; i++) {
+				int v = levelVertices[i];
+				double best = projectLength;
+
+				for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+					double start = latest[csr->outTargets[a]] - csr->outWeights[a];
+
+					if (start < best) {
+						best = start;
+					}
+				}
+
+				latest[v] = best;
+			}
+		}
+	}
+};
+
+#endif /* CRITICALPATHANALYSIS_H_ */
@@ -31,17 +31,7 @@ class DefaultDirectedGraph : public AbstractBaseGraph<V, E>, public DirectedGrap
      * @param edgeClass class on which to base factory for edges
      */
 public: DefaultDirectedGraph(E* edgeClass)
-    {
-	//request heap-memory and call the constructor for initialisation
-
-
-   ClassBasedEdgeFactory<V, E>* ef = new ClassBasedEdgeFactory<V, E>(edgeClass);
-    //Reference to the new object
-    this->DefaultDirectedGraph(ef);
-
-
-
-    }
+		: AbstractBaseGraph<V, E>(new ClassBasedEdgeFactory<V, E>(), false, true, true){}
 
     /**
      * Creates a new directed graph with the specified edge factory.
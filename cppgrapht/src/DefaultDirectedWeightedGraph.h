@@ -35,13 +35,7 @@ template< class V, class E>
      * @param edgeClass class on which to base factory for edges
      */
 public:
-        DefaultDirectedWeightedGraph(E* edgeClass)
-    {
-      //request heap-memory and call the constructor for initialisation
-       ClassBasedEdgeFactory<V, E>* ef = new ClassBasedEdgeFactory<V, E>(edgeClass);
-
-           this->DefaultDirectedWeightedGraph(ef);
-    }
+        DefaultDirectedWeightedGraph(E* edgeClass) : DefaultDirectedGraph<V, E>(edgeClass){}
 
     /**
      * Creates a new directed weighted graph with the specified edge factory.
@@ -52,6 +46,14 @@ public:
  DefaultDirectedWeightedGraph(EdgeFactory<V, E>* ef) : DefaultDirectedGraph<V, E>(ef){}
        // Destructer
        virtual ~DefaultDirectedWeightedGraph(){}
+
+	/**
+	 * @see WeightedGraph#setEdgeWeight(Object, double)
+	 */
+	void setEdgeWeight(E* e, double weight)
+	{
+		AbstractBaseGraph<V, E>::setEdgeWeight(e, weight);
+	}
 };
 
 
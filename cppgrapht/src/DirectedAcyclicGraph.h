@@ -0,0 +1,260 @@
+#ifndef DIRECTEDACYCLICGRAPH_H_
+#define DIRECTEDACYCLICGRAPH_H_
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <DefaultDirectedGraph.h>
+#include <EdgeFactory.h>
+
+/**
+ * A directed graph which rejects every edge that would close a cycle. A
+ * topological order of the vertices is kept up to date on every insertion
+ * with the dynamic topological sort of Pearce and Kelly ("A Dynamic
+ * Topological Sort Algorithm for Directed Acyclic Graphs", 2006).
+ *
+ * <p>Every vertex holds a distinct index, and every edge leads from a lower
+ * to a higher index. An edge <code>(x, y)</code> agreeing with the order is
+ * added at once. Otherwise only the affected region between the two indices
+ * is searched: forward from <code>y</code> over the vertices with an index
+ * below that of <code>x</code>, and backward from <code>x</code> over the
+ * vertices with an index above that of <code>y</code>. If the forward search
+ * meets <code>x</code> the edge would close a cycle; if not, the two sets
+ * found swap places within the indices they occupy. No insertion ever
+ * searches the whole graph.</p>
+ *
+ * @see TopologicalSort
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class DirectedAcyclicGraph : public DefaultDirectedGraph<V, E>
+{
+public:
+	/**
+	 * Topological index of every vertex.
+	 */
+	map<V*, int> topologicalIndex;
+
+	/**
+	 * The vertices by topological index. Indices of removed vertices are not
+	 * reused, so there may be gaps.
+	 */
+	map<int, V*> vertexAtIndex;
+
+	/**
+	 * Creates a new directed acyclic graph.
+	 *
+	 * @param edgeClass class on which to base factory for edges
+	 */
+	DirectedAcyclicGraph(E* edgeClass) : DefaultDirectedGraph<V, E>(edgeClass)
+	{
+		nextIndex = 0;
+	}
+
+	/**
+	 * Creates a new directed acyclic graph with the specified edge factory.
+	 *
+	 * @param ef the edge factory of the new graph.
+	 */
+	DirectedAcyclicGraph(EdgeFactory<V, E>* ef) : DefaultDirectedGraph<V, E>(ef)
+	{
+		nextIndex = 0;
+	}
+
+	virtual ~DirectedAcyclicGraph() {}
+
+	/**
+	 * Adds the vertex behind all other vertices in the topological order.
+	 *
+	 * @see Graph#addVertex(Object)
+	 */
+	bool addVertex(V* v)
+	{
+		if (!AbstractBaseGraph<V, E>::addVertex(v)) {
+			return false;
+		}
+
+		topologicalIndex[v] = nextIndex;
+		vertexAtIndex[nextIndex] = v;
+		nextIndex++;
+
+		return true;
+	}
+
+	/**
+	 * @see Graph#addEdge(Object, Object)
+	 *
+	 * @throws invalid_argument if the edge would induce a cycle.
+	 */
+	E* addEdge(V* sourceVertex, V* targetVertex)
+	{
+		this->assertVertexExist(sourceVertex);
+		this->assertVertexExist(targetVertex);
+
+		updateOrder(sourceVertex, targetVertex);
+
+		return AbstractBaseGraph<V, E>::addEdge(sourceVertex, targetVertex);
+	}
+
+	/**
+	 * @see Graph#addEdge(Object, Object, Object)
+	 *
+	 * @throws invalid_argument if the edge would induce a cycle.
+	 */
+	bool addEdge(V* sourceVertex, V* targetVertex, E* e)
+	{
+		if (e == NULL) {
+			throw new invalid_argument("NULL-pointer given for e");
+		} else if (this->containsEdge(e)) {
+			return false;
+		}
+
+		this->assertVertexExist(sourceVertex);
+		this->assertVertexExist(targetVertex);
+
+		updateOrder(sourceVertex, targetVertex);
+
+		return AbstractBaseGraph<V, E>::addEdge(sourceVertex, targetVertex, e);
+	}
+
+	/**
+	 * @see Graph#removeVertex(Object)
+	 */
+	bool removeVertex(V* v)
+	{
+		if (!AbstractBaseGraph<V, E>::removeVertex(v)) {
+			return false;
+		}
+
+		vertexAtIndex.erase(topologicalIndex[v]);
+		topologicalIndex.erase(v);
+
+		return true;
+	}
+
+	/**
+	 * Returns the vertices in topological order.
+	 *
+	 * @return list of all vertices
+	 */
+	list<V*>* getTopologicalOrder()
+	{
+		list<V*>* order = new list<V*>();
+
+		typename map<int, V*>::iterator it;
+		for (it = vertexAtIndex.begin(); it != vertexAtIndex.end(); ++it) {
+			order->push_back(it->second);
+		}
+
+		return order;
+	}
+
+private:
+	int nextIndex;
+
+	/**
+	 * Restores the order for a new edge from x to y, or throws if it would
+	 * close a cycle.
+	 */
+	void updateOrder(V* x, V* y)
+	{
+		if (x == y) {
+			throw new invalid_argument("Edge would induce a cycle");
+		}
+
+		int lower = topologicalIndex[y];
+		int upper = topologicalIndex[x];
+
+		if (upper < lower) {
+			return; // already in order
+		}
+
+		vector<V*> forward;
+		vector<V*> backward;
+
+		if (!collect(y, upper, true, forward)) {
+			throw new invalid_argument("Edge would induce a cycle");
+		}
+		collect(x, lower, false, backward);
+
+		// backward set first, then forward set, into the same indices
+		vector<pair<int, V*> > moved;
+		vector<int> indices;
+
+		sortByIndex(backward, moved, indices);
+		sortByIndex(forward, moved, indices);
+		sort(indices.begin(), indices.end());
+
+		for (int i = 0; i < (int) moved.size(); i++) {
+			vertexAtIndex.erase(moved[i].first);
+		}
+		for (int i = 0; i < (int) moved.size(); i++) {
+			topologicalIndex[moved[i].second] = indices[i];
+			vertexAtIndex[indices[i]] = moved[i].second;
+		}
+	}
+
+	/**
+	 * Collects the vertices reachable from the start vertex without leaving
+	 * the affected region: forward over the indices below the bound,
+	 * backward over the indices above it. Returns <code>false</code> if the
+	 * forward search reaches the bound itself, which closes a cycle.
+	 */
+	bool collect(V* start, int bound, bool forward, vector<V*>& found)
+	{
+		set<V*> visited;
+		vector<V*> stack(1, start);
+		visited.insert(start);
+
+		while (!stack.empty()) {
+			V* v = stack.back();
+			stack.pop_back();
+			found.push_back(v);
+
+			set<E*>* edges = forward
+				? this->outgoingEdgesOf(v)
+				: this->incomingEdgesOf(v);
+
+			typename set<E*>::iterator it;
+			for (it = edges->begin(); it != edges->end(); ++it) {
+				V* w = forward ? this->getEdgeTarget(*it) : this->getEdgeSource(*it);
+				int index = topologicalIndex[w];
+
+				if (forward && index == bound) {
+					return false;
+				}
+				if ((forward ? index < bound : index > bound)
+					&& visited.insert(w).second)
+				{
+					stack.push_back(w);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void sortByIndex(
+		vector<V*>& vertices,
+		vector<pair<int, V*> >& moved,
+		vector<int>& indices)
+	{
+		vector<pair<int, V*> > byIndex;
+
+		for (int i = 0; i < (int) vertices.size(); i++) {
+			byIndex.push_back(make_pair(topologicalIndex[vertices[i]], vertices[i]));
+		}
+
+		sort(byIndex.begin(), byIndex.end());
+
+		for (int i = 0; i < (int) byIndex.size(); i++) {
+			moved.push_back(byIndex[i]);
+			indices.push_back(byIndex[i].first);
+		}
+	}
+};
+
+#endif /* DIRECTEDACYCLICGRAPH_H_ */
@@ -25,12 +25,44 @@ class DirectedMultigraph: public AbstractBaseGraph<V, E>, public DirectedGraph<V
      */
 
 public:
-	DirectedMultigraph(EdgeFactory<V, E>* ef) : AbstractBaseGraph<V, E>(ef, true, true){}
+	DirectedMultigraph(EdgeFactory<V, E>* ef) : AbstractBaseGraph<V, E>(ef, true, true, true){}
 
 	//~ Destructors -----------------------------------------------------------
 
 	virtual ~DirectedMultigraph(){}
 
+	/**
+	 * @see DirectedGraph#inDegreeOf(Object)
+	 */
+	int inDegreeOf(V* vertex)
+	{
+		return this->specifics->inDegreeOf(vertex);
+	}
+
+	/**
+	 * @see DirectedGraph#incomingEdgesOf(Object)
+	 */
+	set<E*>* incomingEdgesOf(V* vertex)
+	{
+		return this->specifics->incomingEdgesOf(vertex);
+	}
+
+	/**
+	 * @see DirectedGraph#outDegreeOf(Object)
+	 */
+	int outDegreeOf(V* vertex)
+	{
+		return this->specifics->outDegreeOf(vertex);
+	}
+
+	/**
+	 * @see DirectedGraph#outgoingEdgesOf(Object)
+	 */
+	set<E*>* outgoingEdgesOf(V* vertex)
+	{
+		return this->specifics->outgoingEdgesOf(vertex);
+	}
+
 };
 
 #endif /* DIRECTEDMULTIGRAPH_H_ */
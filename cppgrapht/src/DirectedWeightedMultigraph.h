@@ -33,6 +33,14 @@ public:
 
 	virtual ~DirectedWeightedMultigraph(){}
 
+	/**
+	 * @see WeightedGraph#setEdgeWeight(Object, double)
+	 */
+	void setEdgeWeight(E* e, double weight)
+	{
+		AbstractBaseGraph<V, E>::setEdgeWeight(e, weight);
+	}
+
 };
 
 #endif /* DIRECTEDWEIGHTEDMULTIGRAPH_H_ */
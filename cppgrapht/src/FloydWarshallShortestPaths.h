@@ -0,0 +1,296 @@
+#ifndef FLOYDWARSHALLSHORTESTPATHS_H_
+#define FLOYDWARSHALLSHORTESTPATHS_H_
+
+#include <cmath>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+#include <GraphPath.h>
+#include <GraphPathImpl.h>
+
+/**
+ * The <a href="http://en.wikipedia.org/wiki/Floyd-Warshall_algorithm">
+ * Floyd-Warshall algorithm</a> computing the distances between all pairs of
+ * vertices into a dense matrix. Suited for small, dense graphs; time is
+ * <code>O(n^3)</code> and memory <code>O(n^2)</code>.
+ *
+ * <p>The matrix is processed in square tiles of <code>BLOCK_SIZE</code>
+ * vertices (Venkataraman, Sahni and Mukhopadhyaya, "A Blocked All-Pairs
+ * Shortest-Paths Algorithm", 2003). For every diagonal tile the algorithm
+ * first closes that tile, then all tiles in its row and column, then all
+ * remaining tiles; the tiles of the last two phases are independent and are
+ * processed in parallel when compiled with OpenMP. The innermost loop is a
+ * plain min-plus update of one contiguous tile row, which the compiler turns
+ * into SIMD instructions.</p>
+ *
+ * <p>No predecessor matrix is kept. Paths are reconstructed on demand from
+ * the distances: {@link #getShortestPath} follows the edges <code>(u,
+ * x)</code> with <code>w(u, x) + d(x, t) = d(u, t)</code>.</p>
+ *
+ * <p>Negative edge weights are allowed, negative cycles are detected but no
+ * distances are defined then.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class FloydWarshallShortestPaths
+{
+public:
+	static const int BLOCK_SIZE = 64;
+
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+	int vertexCount;
+
+	/**
+	 * Row length of the padded matrix, a multiple of <code>BLOCK_SIZE</code>.
+	 */
+	int stride;
+
+	/**
+	 * d(i, j) at index <code>i * stride + j</code>.
+	 */
+	vector<double> distances;
+
+	/**
+	 * Computes the distances between all pairs of vertices of the specified
+	 * graph.
+	 *
+	 * @param graph the graph
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	FloydWarshallShortestPaths(Graph<V, E>* graph)
+	{
+		this->graph = graph;
+		csr = new CSRGraph<V, E>(graph);
+		vertexCount = csr->vertexCount;
+
+		int blocks = (vertexCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+		stride = blocks * BLOCK_SIZE;
+
+		distances.assign((long) stride * stride, numeric_limits<double>::infinity());
+
+		for (int v = 0; v < vertexCount; v++) {
+			at(v, v) = 0.0;
+		}
+		for (int u = 0; u < vertexCount; u++) {
+			for (int a = csr->outOffsets[u]; a < csr->outOffsets[u + 1]; a++) {
+				double& d = at(u, csr->outTargets[a]);
+
+				if (csr->outWeights[a] < d) {
+					d = csr->outWeights[a];
+				}
+			}
+		}
+
+		for (int k = 0; k < blocks; k++) {
+			closeTile(k, k, k);
+
+			#pragma omp parallel for schedule(dynamic, 1)
+			for (int t = 0; t < 2 * blocks; t++) {
+				int other = t / 2;
+
+				if (other == k) {
+					continue;
+				}
+				if (t % 2 == 0) {
+					closeTile(k, other, k);
+				} else {
+					closeTile(other, k, k);
+				}
+			}
+
+			#pragma omp parallel for schedule(dynamic, 1)
+			for (int t = 0; t < blocks * blocks; t++) {
+				int i = t / blocks;
+				int j = t % blocks;
+
+				if (i != k && j != k) {
+					closeTile(i, j, k);
+				}
+			}
+		}
+	}
+
+	virtual ~FloydWarshallShortestPaths()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Returns whether the graph contains a negative-weight cycle.
+	 *
+	 * @return <code>true</code> if there is a negative cycle.
+	 */
+	bool hasNegativeCycle()
+	{
+		for (int v = 0; v < vertexCount; v++) {
+			if (at(v, v) < 0.0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Returns the length of the shortest path between two vertices.
+	 *
+	 * @param a first vertex
+	 * @param b second vertex
+	 *
+	 * @return the distance, or infinity if there is no path.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	double shortestDistance(V* a, V* b)
+	{
+		return at(indexOf(a), indexOf(b));
+	}
+
+	/**
+	 * Returns the diameter of the graph, the longest of all shortest paths.
+	 *
+	 * @return the diameter, infinity if some vertex cannot reach another.
+	 */
+	double getDiameter()
+	{
+		double diameter = 0.0;
+
+		for (int i = 0; i < vertexCount; i++) {
+			for (int j = 0; j < vertexCount; j++) {
+				if (at(i, j) > diameter) {
+					diameter = at(i, j);
+				}
+			}
+		}
+
+		return diameter;
+	}
+
+	/**
+	 * Reconstructs the shortest path between two vertices. Among the edges
+	 * which lie on a shortest path the one with the fewest hops is taken,
+	 * so zero-weight cycles do no harm. An edge counts as lying on a
+	 * shortest path up to a rounding tolerance relative to the magnitudes
+	 * of its weight and the distances compared.
+	 *
+	 * @param a the start vertex
+	 * @param b the end vertex
+	 *
+	 * @return the path, or <code>NULL</code> if there is no path.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 * @throws logic_error if the graph contains a negative cycle or the
+	 * rounding errors of the distances exceed the tolerance.
+	 */
+	GraphPath<V, E>* getShortestPath(V* a, V* b)
+	{
+		int s = indexOf(a);
+		int t = indexOf(b);
+
+		if (hasNegativeCycle()) {
+			throw new logic_error("Graph contains a negative-weight cycle");
+		}
+		if (at(s, t) == numeric_limits<double>::infinity()) {
+			return NULL;
+		}
+
+		// breadth-first search along the tight edges towards t
+		vector<int> parentEdge(vertexCount, -1);
+		vector<int> parent(vertexCount, -1);
+		vector<int> queue;
+		parent[s] = s;
+		queue.push_back(s);
+
+		for (int head = 0; head < (int) queue.size() && parent[t] < 0; head++) {
+			int u = queue[head];
+			double rest = at(u, t);
+
+			for (int i = csr->outOffsets[u]; i < csr->outOffsets[u + 1]; i++) {
+				int x = csr->outTargets[i];
+				double w = csr->outWeights[i];
+
+				// the distances may cancel to about zero on mixed signs, so
+				// the tolerance follows every term of the comparison
+				if (parent[x] < 0
+					&& w + at(x, t) <= rest + 1e-9 * (fabs(w) + fabs(at(x, t)) + fabs(rest)))
+				{
+					parent[x] = u;
+					parentEdge[x] = csr->outEdgeIds[i];
+					queue.push_back(x);
+				}
+			}
+		}
+
+		if (parent[t] < 0) {
+			throw new logic_error("Shortest path not found among the tight edges");
+		}
+
+		list<E*>* edgeList = new list<E*>();
+		double weight = 0.0;
+
+		for (int v = t; v != s; v = parent[v]) {
+			edgeList->push_front(csr->edges[parentEdge[v]]);
+			weight += csr->edgeWeights[parentEdge[v]];
+		}
+
+		return new GraphPathImpl<V, E>(graph, a, b, edgeList, weight);
+	}
+
+private:
+	double& at(int i, int j)
+	{
+		return distances[(long) i * stride + j];
+	}
+
+	int indexOf(V* v)
+	{
+		int id = csr->indexOf(v);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return id;
+	}
+
+	/**
+	 * Relaxes tile <code>(bi, bj)</code> over the intermediate vertices of
+	 * block <code>bk</code>: <code>C = min(C, A (x) B)</code> in the min-plus
+	 * semiring with <code>A = (bi, bk)</code> and <code>B = (bk, bj)</code>.
+	 * The tiles may coincide; since <code>d(k, k) = 0</code> the rows and
+	 * columns read in step <code>k</code> do not change in that step.
+	 */
+	void closeTile(int bi, int bj, int bk)
+	{
+		double* base = &distances[0];
+		long rowA = (long) bi * BLOCK_SIZE;
+		long colB = (long) bj * BLOCK_SIZE;
+		long mid = (long) bk * BLOCK_SIZE;
+
+		for (int k = 0; k < BLOCK_SIZE; k++) {
+			const double* rowK = base + (mid + k) * stride + colB;
+
+			for (int i = 0; i < BLOCK_SIZE; i++) {
+				double* row = base + (rowA + i) * stride + colB;
+				double dik = base[(rowA + i) * stride + mid + k];
+
+				if (dik == numeric_limits<double>::infinity()) {
+					continue;
+				}
+
+				for (int j = 0; j < BLOCK_SIZE; j++) {
+					double candidate = dik + rowK[j];
+					row[j] = candidate < row[j] ? candidate : row[j];
+				}
+			}
+		}
+	}
+};
+
+#endif /* FLOYDWARSHALLSHORTESTPATHS_H_ */
@@ -0,0 +1,93 @@
+#ifndef GRAPHPATHIMPL_H_
+#define GRAPHPATHIMPL_H_
+
+#include <list>
+#include <Graph.h>
+#include <GraphPath.h>
+
+/**
+ * A plain {@link GraphPath} which stores the edge list handed to it at
+ * construction time. The path takes ownership of the edge list.
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class GraphPathImpl : public GraphPath<V, E>
+{
+public:
+	Graph<V, E>* graph;
+	V* startVertex;
+	V* endVertex;
+	list<E*>* edgeList;
+	double weight;
+
+	/**
+	 * Creates a new path.
+	 *
+	 * @param graph the graph over which the path is defined
+	 * @param startVertex the first vertex of the path
+	 * @param endVertex the last vertex of the path
+	 * @param edgeList the edges of the path, in traversal order
+	 * @param weight the total weight of the path
+	 */
+	GraphPathImpl(
+		Graph<V, E>* graph,
+		V* startVertex,
+		V* endVertex,
+		list<E*>* edgeList,
+		double weight)
+	{
+		this->graph = graph;
+		this->startVertex = startVertex;
+		this->endVertex = endVertex;
+		this->edgeList = edgeList;
+		this->weight = weight;
+	}
+
+	virtual ~GraphPathImpl()
+	{
+		delete edgeList;
+	}
+
+	/**
+	 * @see GraphPath#getGraph()
+	 */
+	Graph<V, E>* getGraph()
+	{
+		return graph;
+	}
+
+	/**
+	 * @see GraphPath#getStartVertex()
+	 */
+	V* getStartVertex()
+	{
+		return startVertex;
+	}
+
+	/**
+	 * @see GraphPath#getEndVertex()
+	 */
+	V* getEndVertex()
+	{
+		return endVertex;
+	}
+
+	/**
+	 * @see GraphPath#getEdgeList()
+	 */
+	list<E*>* getEdgeList()
+	{
+		return edgeList;
+	}
+
+	/**
+	 * @see GraphPath#getWeight()
+	 */
+	double getWeight()
+	{
+		return weight;
+	}
+};
+
+#endif /* GRAPHPATHIMPL_H_ */
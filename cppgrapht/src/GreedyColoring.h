@@ -0,0 +1,388 @@
+#ifndef GREEDYCOLORING_H_
+#define GREEDYCOLORING_H_
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <sys/time.h>
+#include <CSRGraph.h>
+#include <Graph.h>
+#include <KCoreDecomposition.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Greedy vertex coloring: the vertices are colored one by one with the
+ * smallest color, from <code>0</code> on, that none of their neighbours has.
+ * Edge directions are ignored and self-loops, which no coloring can satisfy,
+ * are skipped. The strategies differ in the order of the vertices:
+ *
+ * <ul>
+ * <li><code>LARGEST_FIRST</code> colors by descending degree (Welsh and
+ * Powell), sorted by a counting sort.</li>
+ * <li><code>SMALLEST_LAST</code> colors in reverse order of the removal of
+ * the vertex of least degree (Matula and Beck), the degeneracy ordering of
+ * {@link KCoreDecomposition}, which uses at most <code>degeneracy + 1</code>
+ * colors.</li>
+ * <li><code>DSATUR</code> always colors the vertex with the most distinct
+ * colors among its neighbours next, ties broken by degree (Br&eacute;laz).
+ * It keeps the vertices in a balanced search tree and is the slowest, but
+ * usually needs the fewest colors.</li>
+ * <li><code>SPECULATIVE</code> colors all vertices at once in parallel when
+ * compiled with OpenMP, every thread reading the colors of the neighbours as
+ * they are (Gebremedhin and Manne; &Ccedil;ataly&uuml;rek et al.). Adjacent
+ * vertices colored alike concurrently are then detected in parallel, and the
+ * one of higher id of each such pair is colored again in the next round,
+ * until no conflict is left.</li>
+ * </ul>
+ *
+ * <p>Every run reports the number of colors and the time it took, so the
+ * strategies can be compared on a given graph.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class GreedyColoring
+{
+public:
+	enum Strategy { LARGEST_FIRST, SMALLEST_LAST, DSATUR, SPECULATIVE };
+
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * Color of every vertex by id.
+	 */
+	vector<int> color;
+
+	int colorCount;
+
+	/**
+	 * Number of coloring rounds of the last run, more than one only for
+	 * speculative coloring with conflicts.
+	 */
+	int roundCount;
+
+	/**
+	 * Wall clock time of the last run in seconds.
+	 */
+	double seconds;
+
+	/**
+	 * Prepares the coloring of the specified graph.
+	 *
+	 * @param g the graph
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	GreedyColoring(Graph<V, E>* g)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+		calculated = false;
+	}
+
+	virtual ~GreedyColoring()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Colors the graph with the specified strategy.
+	 *
+	 * @param strategy the strategy
+	 */
+	void run(Strategy strategy)
+	{
+		double start = now();
+		int n = csr->vertexCount;
+
+		color.assign(n, -1);
+		roundCount = 1;
+
+		if (strategy == LARGEST_FIRST) {
+			colorInOrder(largestFirstOrder());
+		} else if (strategy == SMALLEST_LAST) {
+			KCoreDecomposition<V, E> cores(csr);
+			cores.run();
+
+			vector<int> order(cores.order.rbegin(), cores.order.rend());
+			colorInOrder(order);
+		} else if (strategy == DSATUR) {
+			colorBySaturation();
+		} else {
+			colorSpeculatively();
+		}
+
+		colorCount = 0;
+		for (int v = 0; v < n; v++) {
+			if (color[v] >= colorCount) {
+				colorCount = color[v] + 1;
+			}
+		}
+
+		seconds = now() - start;
+		calculated = true;
+	}
+
+	/**
+	 * Returns the number of colors used.
+	 *
+	 * @return the number of colors
+	 *
+	 * @throws logic_error if the graph was not colored yet.
+	 */
+	int getColorCount()
+	{
+		checkCalculated();
+
+		return colorCount;
+	}
+
+	/**
+	 * Returns the time the last run took.
+	 *
+	 * @return wall clock time in seconds
+	 *
+	 * @throws logic_error if the graph was not colored yet.
+	 */
+	double getSeconds()
+	{
+		checkCalculated();
+
+		return seconds;
+	}
+
+	/**
+	 * Returns the color of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the color, from <code>0</code> to {@link #getColorCount}
+	 * <code>- 1</code>
+	 *
+	 * @throws logic_error if the graph was not colored yet.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	int getColor(V* vertex)
+	{
+		checkCalculated();
+
+		int v = csr->indexOf(vertex);
+
+		if (v < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return color[v];
+	}
+
+	/**
+	 * Returns the color classes, in the order of their colors.
+	 *
+	 * @return list of the sets of vertices sharing a color
+	 *
+	 * @throws logic_error if the graph was not colored yet.
+	 */
+	list<set<V*>*>* getColorClasses()
+	{
+		checkCalculated();
+
+		vector<set<V*>*> classes(colorCount);
+
+		for (int c = 0; c < colorCount; c++) {
+			classes[c] = new set<V*>();
+		}
+		for (int v = 0; v < csr->vertexCount; v++) {
+			classes[color[v]]->insert(csr->vertices[v]);
+		}
+
+		return new list<set<V*>*>(classes.begin(), classes.end());
+	}
+
+private:
+	typedef pair<pair<int, int>, int> Key;
+
+	bool calculated;
+
+	void checkCalculated()
+	{
+		if (!calculated) {
+			throw new logic_error("Graph has not been colored");
+		}
+	}
+
+	static double now()
+	{
+#ifdef _OPENMP
+		return omp_get_wtime();
+#else
+		// clock() would count processor time
+		timeval tv;
+		gettimeofday(&tv, NULL);
+
+		return tv.tv_sec + tv.tv_usec / 1e6;
+#endif
+	}
+
+	/**
+	 * Returns the smallest color none of the neighbours has, marking the
+	 * colors seen with the vertex in <code>forbidden</code>.
+	 */
+	int smallestFreeColor(int v, vector<int>& forbidden)
+	{
+		for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+			int u = csr->outTargets[a];
+			int c = color[u];
+
+			if (c >= 0 && u != v) {
+				forbidden[c] = v;
+			}
+		}
+
+		int c = 0;
+
+		while (forbidden[c] == v) {
+			c++;
+		}
+
+		return c;
+	}
+
+	void colorInOrder(const vector<int>& order)
+	{
+		int n = csr->vertexCount;
+		vector<int> forbidden(n + 1, -1);
+
+		for (int i = 0; i < n; i++) {
+			int v = order[i];
+
+			color[v] = smallestFreeColor(v, forbidden);
+		}
+	}
+
+	vector<int> largestFirstOrder()
+	{
+		int n = csr->vertexCount;
+		int maxDegree = 0;
+
+		for (int v = 0; v < n; v++) {
+			maxDegree = max(maxDegree, csr->outDegreeOf(v));
+		}
+
+		vector<int> start(maxDegree + 2, 0);
+		vector<int> order(n);
+
+		for (int v = 0; v < n; v++) {
+			start[maxDegree - csr->outDegreeOf(v) + 1]++;
+		}
+		for (int d = 0; d <= maxDegree; d++) {
+			start[d + 1] += start[d];
+		}
+		for (int v = 0; v < n; v++) {
+			order[start[maxDegree - csr->outDegreeOf(v)]++] = v;
+		}
+
+		return order;
+	}
+
+	void colorBySaturation()
+	{
+		int n = csr->vertexCount;
+		vector<set<int> > seen(n);
+		vector<int> forbidden(n + 1, -1);
+		set<Key> queue;
+
+		for (int v = 0; v < n; v++) {
+			queue.insert(Key(pair<int, int>(0, csr->outDegreeOf(v)), -v));
+		}
+
+		while (!queue.empty()) {
+			typename set<Key>::iterator last = queue.end();
+			--last;
+
+			int v = -last->second;
+			queue.erase(last);
+
+			int c = smallestFreeColor(v, forbidden);
+
+			color[v] = c;
+
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				int u = csr->outTargets[a];
+
+				if (color[u] < 0 && seen[u].insert(c).second) {
+					int degree = csr->outDegreeOf(u);
+
+					queue.erase(Key(pair<int, int>(seen[u].size() - 1, degree), -u));
+					queue.insert(Key(pair<int, int>(seen[u].size(), degree), -u));
+				}
+			}
+		}
+	}
+
+	void colorSpeculatively()
+	{
+		int n = csr->vertexCount;
+		vector<int> pending(n);
+
+		for (int v = 0; v < n; v++) {
+			pending[v] = v;
+		}
+
+		roundCount = 0;
+
+		while (!pending.empty()) {
+			int count = pending.size();
+			vector<int> conflicts;
+
+			roundCount++;
+
+			#pragma omp parallel
+			{
+				vector<int> forbidden(n + 1, -1);
+
+				#pragma omp for schedule(dynamic, 256)
+				for (int i = 0; i < count; i++) {
+					int v = pending[i];
+
+					color[v] = smallestFreeColor(v, forbidden);
+				}
+
+				vector<int> local;
+
+				#pragma omp for schedule(dynamic, 256) nowait
+				for (int i = 0; i < count; i++) {
+					int v = pending[i];
+
+					for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+						int u = csr->outTargets[a];
+
+						if (u < v && color[u] == color[v]) {
+							local.push_back(v);
+							break;
+						}
+					}
+				}
+
+				#pragma omp critical
+				{
+					conflicts.insert(conflicts.end(), local.begin(), local.end());
+				}
+			}
+
+			for (int i = 0; i < (int) conflicts.size(); i++) {
+				color[conflicts[i]] = -1;
+			}
+
+			pending.swap(conflicts);
+		}
+	}
+};
+
+#endif /* GREEDYCOLORING_H_ */
@@ -0,0 +1,505 @@
+#ifndef HOPCROFTKARPBIPARTITEMATCHING_H_
+#define HOPCROFTKARPBIPARTITEMATCHING_H_
+
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * The algorithm of Hopcroft and Karp computing a maximum cardinality
+ * matching of a bipartite graph; edge directions are ignored. The two sides
+ * are either given as partitions or found by two-coloring the graph.
+ *
+ * <p>The matching is first grown greedily by the heuristic of Karp and
+ * Sipser: a vertex with a single unmatched neighbor is matched to it, which
+ * never loses optimality, and only if there is none an arbitrary edge is
+ * taken. Hopcroft-Karp then only has to augment what is left. Every phase
+ * labels the left vertices by a breadth-first search from the unmatched
+ * ones, alternating between arbitrary and matched edges, up to the first
+ * level reaching an unmatched right vertex. A depth-first search along these
+ * levels then augments a maximal set of shortest augmenting paths. There are
+ * at most <code>O(sqrt(n))</code> phases of <code>O(m)</code> each.</p>
+ *
+ * <p>Optionally the levels of the breadth-first search are expanded in
+ * parallel when compiled with OpenMP, the vertices being claimed by
+ * compare-and-swap. The depth-first search stays sequential.</p>
+ *
+ * <p>By K&ouml;nig's theorem the size of a minimum vertex cover equals that
+ * of the matching; {@link #getMinimumVertexCover} constructs one from the
+ * vertices reachable by alternating paths.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class HopcroftKarpBipartiteMatching
+{
+public:
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * Side of every vertex by id, <code>0</code> for the left and <code>1
+	 * </code> for the right one.
+	 */
+	vector<int> side;
+
+	/**
+	 * Matched vertex and edge of every vertex by id, or <code>-1</code> if
+	 * the vertex is unmatched.
+	 */
+	vector<int> mate;
+	vector<int> mateEdge;
+
+	int matchingSize;
+
+	/**
+	 * Number of Hopcroft-Karp phases run after the greedy initialization.
+	 */
+	int phaseCount;
+
+	/**
+	 * Computes a maximum matching of the specified graph, which is
+	 * two-colored to find its sides.
+	 *
+	 * @param g the graph
+	 * @param parallel whether to run the breadth-first searches in parallel
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or not
+	 * bipartite.
+	 */
+	HopcroftKarpBipartiteMatching(Graph<V, E>* g, bool parallel = false)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+		this->parallel = parallel;
+
+		if (!twoColor()) {
+			delete csr;
+			throw new invalid_argument("Graph is not bipartite");
+		}
+
+		run();
+	}
+
+	/**
+	 * Computes a maximum matching of the specified graph between the given
+	 * partitions.
+	 *
+	 * @param g the graph
+	 * @param partition1 the left vertices
+	 * @param partition2 the right vertices
+	 * @param parallel whether to run the breadth-first searches in parallel
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>, or if the
+	 * partitions do not split the vertices or an edge lies within one of
+	 * them.
+	 */
+	HopcroftKarpBipartiteMatching(
+		Graph<V, E>* g,
+		set<V*>* partition1,
+		set<V*>* partition2,
+		bool parallel = false)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+		this->parallel = parallel;
+
+		if (!assignSides(partition1, partition2)) {
+			delete csr;
+			throw new invalid_argument("Partitions do not form a bipartition");
+		}
+
+		run();
+	}
+
+	virtual ~HopcroftKarpBipartiteMatching()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Returns the edges of the maximum matching.
+	 *
+	 * @return set of the matched edges
+	 */
+	set<E*>* getMatching()
+	{
+		set<E*>* matching = new set<E*>();
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			if (side[v] == 0 && mate[v] >= 0) {
+				matching->insert(csr->edges[mateEdge[v]]);
+			}
+		}
+
+		return matching;
+	}
+
+	/**
+	 * Returns the number of edges of the maximum matching.
+	 *
+	 * @return size of the matching
+	 */
+	int getMatchingSize()
+	{
+		return matchingSize;
+	}
+
+	/**
+	 * Returns the size of a minimum vertex cover, which equals that of the
+	 * maximum matching in a bipartite graph.
+	 *
+	 * @return size of a minimum vertex cover
+	 */
+	int getMinimumVertexCoverSize()
+	{
+		return matchingSize;
+	}
+
+	/**
+	 * Returns a minimum vertex cover: the left vertices not reachable from an
+	 * unmatched left vertex by an alternating path, and the right vertices
+	 * which are.
+	 *
+	 * @return set of the cover vertices
+	 */
+	set<V*>* getMinimumVertexCover()
+	{
+		int n = csr->vertexCount;
+		vector<char> reached(n, 0);
+		vector<int> queue;
+
+		for (int v = 0; v < n; v++) {
+			if (side[v] == 0 && mate[v] < 0) {
+				reached[v] = 1;
+				queue.push_back(v);
+			}
+		}
+
+		for (int head = 0; head < (int) queue.size(); head++) {
+			int u = queue[head];
+
+			for (int a = csr->outOffsets[u]; a < csr->outOffsets[u + 1]; a++) {
+				int w = csr->outTargets[a];
+
+				if (!reached[w]) {
+					reached[w] = 1;
+
+					if (mate[w] >= 0 && !reached[mate[w]]) {
+						reached[mate[w]] = 1;
+						queue.push_back(mate[w]);
+					}
+				}
+			}
+		}
+
+		set<V*>* cover = new set<V*>();
+
+		for (int v = 0; v < n; v++) {
+			if ((side[v] == 0) != (reached[v] != 0)) {
+				cover->insert(csr->vertices[v]);
+			}
+		}
+
+		return cover;
+	}
+
+private:
+	bool parallel;
+
+	/**
+	 * Level of every left vertex in the current phase, or <code>-1</code>
+	 * if it is not part of the layered graph.
+	 */
+	vector<int> level;
+
+	/**
+	 * Next arc to try by the depth-first search of every left vertex.
+	 */
+	vector<int> nextArc;
+
+	bool twoColor()
+	{
+		int n = csr->vertexCount;
+		vector<int> queue;
+
+		side.assign(n, -1);
+
+		for (int s = 0; s < n; s++) {
+			if (side[s] >= 0) {
+				continue;
+			}
+
+			side[s] = 0;
+			queue.assign(1, s);
+
+			for (int head = 0; head < (int) queue.size(); head++) {
+				int u = queue[head];
+
+				for (int a = csr->outOffsets[u]; a < csr->outOffsets[u + 1]; a++) {
+					int w = csr->outTargets[a];
+
+					if (side[w] < 0) {
+						side[w] = 1 - side[u];
+						queue.push_back(w);
+					} else if (side[w] == side[u]) {
+						return false;
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	bool assignSides(set<V*>* partition1, set<V*>* partition2)
+	{
+		int n = csr->vertexCount;
+
+		if (partition1 == NULL || partition2 == NULL) {
+			return false;
+		}
+
+		side.assign(n, -1);
+
+		for (int v = 0; v < n; v++) {
+			bool left = partition1->count(csr->vertices[v]) > 0;
+			bool right = partition2->count(csr->vertices[v]) > 0;
+
+			if (left == right) {
+				return false;
+			}
+
+			side[v] = left ? 0 : 1;
+		}
+
+		for (int e = 0; e < csr->edgeCount; e++) {
+			if (side[csr->edgeSources[e]] == side[csr->edgeTargets[e]]) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void run()
+	{
+		int n = csr->vertexCount;
+
+		mate.assign(n, -1);
+		mateEdge.assign(n, -1);
+		matchingSize = 0;
+		phaseCount = 0;
+
+		karpSipser();
+
+		vector<int> free;
+		for (int v = 0; v < n; v++) {
+			if (side[v] == 0 && mate[v] < 0 && csr->outDegreeOf(v) > 0) {
+				free.push_back(v);
+			}
+		}
+
+		while (!free.empty()) {
+			int limit = buildLevels(free);
+
+			if (limit < 0) {
+				break;
+			}
+
+			phaseCount++;
+
+			for (int i = 0; i < n; i++) {
+				nextArc[i] = csr->outOffsets[i];
+			}
+
+			int kept = 0;
+			for (int i = 0; i < (int) free.size(); i++) {
+				if (!augment(free[i], limit)) {
+					free[kept++] = free[i];
+				}
+			}
+			free.resize(kept);
+		}
+	}
+
+	void match(int u, int w, int e)
+	{
+		mate[u] = w;
+		mate[w] = u;
+		mateEdge[u] = e;
+		mateEdge[w] = e;
+	}
+
+	/**
+	 * Greedy initial matching: vertices with a single unmatched neighbor
+	 * first, arbitrary edges only when there are none.
+	 */
+	void karpSipser()
+	{
+		int n = csr->vertexCount;
+		vector<int> degree(n);
+		vector<int> ones;
+
+		for (int v = 0; v < n; v++) {
+			degree[v] = csr->outDegreeOf(v);
+
+			if (degree[v] == 1) {
+				ones.push_back(v);
+			}
+		}
+
+		for (int next = 0; next < n || !ones.empty();) {
+			int v;
+
+			if (!ones.empty()) {
+				v = ones.back();
+				ones.pop_back();
+			} else {
+				v = next++;
+			}
+
+			if (mate[v] >= 0 || degree[v] == 0) {
+				continue;
+			}
+
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1] && mate[v] < 0; a++) {
+				int w = csr->outTargets[a];
+
+				if (mate[w] < 0) {
+					match(v, w, csr->outEdgeIds[a]);
+					matchingSize++;
+				}
+			}
+
+			if (mate[v] < 0) {
+				continue;
+			}
+
+			// the neighbors lose an unmatched neighbor
+			int matched[2] = { v, mate[v] };
+
+			for (int i = 0; i < 2; i++) {
+				int u = matched[i];
+
+				for (int a = csr->outOffsets[u]; a < csr->outOffsets[u + 1]; a++) {
+					int x = csr->outTargets[a];
+
+					if (mate[x] < 0 && --degree[x] == 1) {
+						ones.push_back(x);
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * Labels the left vertices by alternating breadth-first search from the
+	 * unmatched ones. Returns the level from which an unmatched right vertex
+	 * is reached, or <code>-1</code> if there is none and the matching is
+	 * maximum.
+	 */
+	int buildLevels(vector<int>& free)
+	{
+		int n = csr->vertexCount;
+
+		level.assign(n, -1);
+		nextArc.resize(n);
+
+		vector<int> frontier(free);
+		for (int i = 0; i < (int) frontier.size(); i++) {
+			level[frontier[i]] = 0;
+		}
+
+		for (int depth = 0; !frontier.empty(); depth++) {
+			int size = frontier.size();
+			int found = 0;
+			vector<int> next;
+
+			#pragma omp parallel if (parallel)
+			{
+				vector<int> local;
+				int localFound = 0;
+
+				#pragma omp for schedule(dynamic, 256) nowait
+				for (int i = 0; i < size; i++) {
+					int u = frontier[i];
+
+					for (int a = csr->outOffsets[u]; a < csr->outOffsets[u + 1]; a++) {
+						int x = mate[csr->outTargets[a]];
+
+						if (x < 0) {
+							localFound = 1;
+						} else if (level[x] < 0
+							&& __sync_bool_compare_and_swap(&level[x], -1, depth + 1))
+						{
+							local.push_back(x);
+						}
+					}
+				}
+
+				#pragma omp critical
+				{
+					next.insert(next.end(), local.begin(), local.end());
+					found |= localFound;
+				}
+			}
+
+			if (found) {
+				return depth;
+			}
+
+			frontier.swap(next);
+		}
+
+		return -1;
+	}
+
+	/**
+	 * Searches a shortest augmenting path from the specified unmatched left
+	 * vertex along the levels and augments the matching along it. Vertices
+	 * found to lead nowhere leave the layered graph.
+	 */
+	bool augment(int root, int limit)
+	{
+		vector<int> path(1, root);
+
+		while (!path.empty()) {
+			int u = path.back();
+
+			if (nextArc[u] == csr->outOffsets[u + 1]) {
+				level[u] = -1;
+				path.pop_back();
+				continue;
+			}
+
+			int a = nextArc[u];
+			int w = csr->outTargets[a];
+			int x = mate[w];
+
+			if (x < 0 && level[u] == limit) {
+				// flip the path, deepest vertex first
+				for (int i = path.size() - 1; i >= 0; i--) {
+					int b = nextArc[path[i]];
+
+					match(path[i], csr->outTargets[b], csr->outEdgeIds[b]);
+				}
+
+				matchingSize++;
+				return true;
+			}
+
+			if (x >= 0 && level[x] == level[u] + 1 && level[x] <= limit) {
+				path.push_back(x);
+			} else {
+				nextArc[u]++;
+			}
+		}
+
+		return false;
+	}
+};
+
+#endif /* HOPCROFTKARPBIPARTITEMATCHING_H_ */
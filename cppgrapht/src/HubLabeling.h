@@ -0,0 +1,611 @@
+#ifndef HUBLABELING_H_
+#define HUBLABELING_H_
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Exact distance queries with 2-hop hub labels, built by pruned landmark
+ * labeling (Akiba, Iwata and Yoshida, "Fast Exact Shortest-Path Distance
+ * Queries on Large Networks by Pruned Landmark Labeling", SIGMOD 2013).
+ *
+ * <p>Every vertex <code>v</code> stores an out label of pairs <code>(h,
+ * d(v, h))</code> and an in label of pairs <code>(h, d(h, v))</code> (a single
+ * label for undirected graphs) such that every shortest path from <code>
+ * s</code> to <code>t</code> passes a hub found in both the out label of
+ * <code>s</code> and the in label of <code>t</code>. A query is therefore one
+ * merge of two label lists. The hubs are numbered by rank and every label is
+ * kept as two flat arrays, hubs ascending and distances, terminated by an
+ * <code>INT_MAX</code> sentinel hub so the merge loop needs no bounds
+ * checks.</p>
+ *
+ * <p>Vertices are processed in order of decreasing degree. For every one a
+ * shortest path search (a breadth-first search if all weights are
+ * <code>1.0</code>) adds it as hub to the vertices it reaches, pruning where
+ * the existing labels already yield the distance. When compiled with OpenMP
+ * the searches of as many vertices as there are threads run at once, each
+ * pruning against the labels of the earlier batches only; this may add a few
+ * redundant labels but never a wrong one. All edge weights must be
+ * non-negative.</p>
+ *
+ * <p>{@link #write} stores the labels in the native byte order; the reading
+ * constructor needs the vertices in the id order of the writing instance, see
+ * {@link #getVertices}.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class HubLabeling
+{
+public:
+	int vertexCount;
+	bool directed;
+
+	vector<V*> vertices;
+	map<V*, int> vertexIndex;
+
+	vector<int> outOffsets;
+	vector<int> outHubs;
+	vector<double> outDistances;
+
+	/**
+	 * Equal to the out labels for undirected graphs.
+	 */
+	vector<int> inOffsets;
+	vector<int> inHubs;
+	vector<double> inDistances;
+
+	/**
+	 * Builds the labels of the specified graph.
+	 *
+	 * @param graph the graph to be labeled
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or has
+	 * negative edge weights.
+	 */
+	HubLabeling(Graph<V, E>* graph)
+	{
+		CSRGraph<V, E> csr(graph, true);
+
+		if (csr.hasNegativeEdgeWeight()) {
+			throw new invalid_argument("Hub labeling requires non-negative edge weights");
+		}
+
+		vertexCount = csr.vertexCount;
+		directed = csr.directed;
+		vertices = csr.vertices;
+		vertexIndex = csr.vertexIndex;
+
+		Builder builder(&csr);
+		builder.run();
+
+		flatten(builder.outLabels, outOffsets, outHubs, outDistances);
+		if (directed) {
+			flatten(builder.inLabels, inOffsets, inHubs, inDistances);
+		} else {
+			inOffsets = outOffsets;
+			inHubs = outHubs;
+			inDistances = outDistances;
+		}
+	}
+
+	/**
+	 * Reads labels previously stored with {@link #write}.
+	 *
+	 * @param vertices the vertices in the order of {@link #getVertices} of the
+	 * writing instance
+	 * @param in the stream to read from
+	 *
+	 * @throws invalid_argument if the stream is truncated or malformed or does
+	 * not match the vertex count.
+	 */
+	HubLabeling(vector<V*>* vertices, istream& in)
+	{
+		this->vertices = *vertices;
+		vertexCount = vertices->size();
+
+		for (int v = 0; v < vertexCount; v++) {
+			vertexIndex.insert(pair<V*, int>(this->vertices[v], v));
+		}
+
+		int header[3];
+		readArray(in, header, 3);
+		if (header[0] != MAGIC || header[1] != vertexCount) {
+			throw new invalid_argument("Hub labels do not match the vertices");
+		}
+		directed = header[2] != 0;
+
+		read(in, outOffsets);
+		read(in, outHubs);
+		read(in, outDistances);
+		if (directed) {
+			read(in, inOffsets);
+			read(in, inHubs);
+			read(in, inDistances);
+		} else {
+			inOffsets = outOffsets;
+			inHubs = outHubs;
+			inDistances = outDistances;
+		}
+
+		if (!isLabeling(outOffsets, outHubs, outDistances)
+			|| !isLabeling(inOffsets, inHubs, inDistances))
+		{
+			throw new invalid_argument("Malformed hub labels");
+		}
+	}
+
+	/**
+	 * Writes the labels to the specified stream.
+	 *
+	 * @param out the stream to write to
+	 *
+	 * @throws runtime_error if writing fails.
+	 */
+	void write(ostream& out)
+	{
+		int header[3] = { MAGIC, vertexCount, directed ? 1 : 0 };
+		writeArray(out, header, 3);
+
+		write(out, outOffsets);
+		write(out, outHubs);
+		write(out, outDistances);
+		if (directed) {
+			write(out, inOffsets);
+			write(out, inHubs);
+			write(out, inDistances);
+		}
+
+		if (!out) {
+			throw new runtime_error("Writing the hub labels failed");
+		}
+	}
+
+	/**
+	 * Returns the vertices, indexed by their id in the labeling.
+	 *
+	 * @return the vertices in id order
+	 */
+	const vector<V*>* getVertices()
+	{
+		return &vertices;
+	}
+
+	/**
+	 * Returns the length of the shortest path from the source vertex to the
+	 * target vertex.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return the length of the path, or infinity if no path exists.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	double getPathLength(V* sourceVertex, V* targetVertex)
+	{
+		int s = indexOf(sourceVertex);
+		int t = indexOf(targetVertex);
+
+		return intersect(
+			&outHubs[outOffsets[s]], &outDistances[outOffsets[s]],
+			&inHubs[inOffsets[t]], &inDistances[inOffsets[t]]);
+	}
+
+	/**
+	 * Returns the total number of label entries, without sentinels.
+	 *
+	 * @return the number of label entries
+	 */
+	long getLabelCount()
+	{
+		long count = outHubs.size() - vertexCount;
+
+		if (directed) {
+			count += inHubs.size() - vertexCount;
+		}
+
+		return count;
+	}
+
+private:
+	static const int MAGIC = 0x484c0001;
+
+	typedef pair<double, int> Entry;
+
+	/**
+	 * Merges two sentinel terminated labels.
+	 */
+	static double intersect(
+		const int* hubsA,
+		const double* distancesA,
+		const int* hubsB,
+		const double* distancesB)
+	{
+		double best = numeric_limits<double>::infinity();
+		int i = 0;
+		int j = 0;
+
+		while (true) {
+			int a = hubsA[i];
+			int b = hubsB[j];
+
+			if (a == b) {
+				if (a == INT_MAX) {
+					break;
+				}
+
+				double d = distancesA[i] + distancesB[j];
+				if (d < best) {
+					best = d;
+				}
+				i++;
+				j++;
+			} else if (a < b) {
+				i++;
+			} else {
+				j++;
+			}
+		}
+
+		return best;
+	}
+
+	/**
+	 * One label under construction: hub ranks ascending and distances.
+	 */
+	class Label
+	{
+	public:
+		vector<int> hubs;
+		vector<double> distances;
+	};
+
+	/**
+	 * Working arrays of one searching thread.
+	 */
+	class Scratch
+	{
+	public:
+		vector<double> distance;
+		vector<unsigned int> reached;
+		unsigned int stamp;
+		vector<double> rootLabel;
+		vector<Entry> heap;
+		vector<int> queue;
+
+		vector<int> labeled;
+		vector<double> labeledDistances;
+
+		Scratch(int n)
+		{
+			distance.resize(n);
+			reached.assign(n, 0);
+			stamp = 0;
+			rootLabel.assign(n, numeric_limits<double>::infinity());
+			queue.resize(n);
+		}
+	};
+
+	class Builder
+	{
+	public:
+		CSRGraph<V, E>* csr;
+		int n;
+		bool unweighted;
+		vector<int> order;
+		vector<Label> outLabels;
+		vector<Label> inLabels;
+
+		Builder(CSRGraph<V, E>* csr)
+		{
+			this->csr = csr;
+			n = csr->vertexCount;
+			outLabels.resize(n);
+			if (csr->directed) {
+				inLabels.resize(n);
+			}
+
+			unweighted = true;
+			for (int e = 0; e < csr->edgeCount; e++) {
+				if (csr->edgeWeights[e] != 1.0) {
+					unweighted = false;
+				}
+			}
+
+			vector<pair<int, int> > byDegree(n);
+			for (int v = 0; v < n; v++) {
+				byDegree[v] = pair<int, int>(
+					-(csr->outDegreeOf(v) + csr->inDegreeOf(v)), v);
+			}
+			sort(byDegree.begin(), byDegree.end());
+
+			order.resize(n);
+			for (int i = 0; i < n; i++) {
+				order[i] = byDegree[i].second;
+			}
+		}
+
+		void run()
+		{
+			int batch = 1;
+#ifdef _OPENMP
+			batch = omp_get_max_threads();
+#endif
+			int directions = csr->directed ? 2 : 1;
+			vector<Scratch*> scratches(batch * directions, (Scratch*) NULL);
+
+			for (int first = 0; first < n; first += batch) {
+				int jobs = min(batch, n - first) * directions;
+
+				#pragma omp parallel for schedule(dynamic, 1)
+				for (int job = 0; job < jobs; job++) {
+					if (scratches[job] == NULL) {
+						scratches[job] = new Scratch(n);
+					}
+					search(first + job / directions, job % directions == 1, scratches[job]);
+				}
+
+				// commit in rank order, so every label stays sorted by hub
+				for (int job = 0; job < jobs; job++) {
+					int rank = first + job / directions;
+					bool backward = job % directions == 1;
+					vector<Label>& labels = csr->directed && !backward ? inLabels : outLabels;
+					Scratch* s = scratches[job];
+
+					for (int i = 0; i < (int) s->labeled.size(); i++) {
+						labels[s->labeled[i]].hubs.push_back(rank);
+						labels[s->labeled[i]].distances.push_back(s->labeledDistances[i]);
+					}
+				}
+			}
+
+			for (int i = 0; i < (int) scratches.size(); i++) {
+				delete scratches[i];
+			}
+		}
+
+		/**
+		 * Pruned search from the root of the given rank. A forward search
+		 * collects in label entries, a backward one out label entries.
+		 */
+		void search(int rank, bool backward, Scratch* s)
+		{
+			int root = order[rank];
+			Label& rootLabel = !csr->directed ? outLabels[root]
+				: (backward ? inLabels[root] : outLabels[root]);
+			vector<Label>& targetLabels = !csr->directed ? outLabels
+				: (backward ? outLabels : inLabels);
+			const vector<int>& offsets = backward ? csr->inOffsets : csr->outOffsets;
+			const vector<int>& heads = backward ? csr->inSources : csr->outTargets;
+			const vector<double>& weights = backward ? csr->inWeights : csr->outWeights;
+
+			for (int i = 0; i < (int) rootLabel.hubs.size(); i++) {
+				s->rootLabel[rootLabel.hubs[i]] = rootLabel.distances[i];
+			}
+
+			if (++s->stamp == 0) {
+				s->reached.assign(n, 0);
+				s->stamp = 1;
+			}
+			s->labeled.clear();
+			s->labeledDistances.clear();
+			s->heap.clear();
+
+			int head = 0;
+			int tail = 0;
+			s->reached[root] = s->stamp;
+			s->distance[root] = 0.0;
+			if (unweighted) {
+				s->queue[tail++] = root;
+			} else {
+				s->heap.push_back(Entry(0.0, root));
+			}
+
+			while (unweighted ? head < tail : !s->heap.empty()) {
+				int v;
+				double d;
+
+				if (unweighted) {
+					v = s->queue[head++];
+					d = s->distance[v];
+				} else {
+					pop_heap(s->heap.begin(), s->heap.end(), greater<Entry>());
+					d = s->heap.back().first;
+					v = s->heap.back().second;
+					s->heap.pop_back();
+
+					if (d > s->distance[v]) {
+						continue;
+					}
+				}
+
+				// prune if an already committed hub covers (root, v)
+				Label& label = targetLabels[v];
+				bool covered = false;
+
+				for (int i = 0; i < (int) label.hubs.size(); i++) {
+					if (s->rootLabel[label.hubs[i]] + label.distances[i] <= d) {
+						covered = true;
+						break;
+					}
+				}
+				if (covered) {
+					continue;
+				}
+
+				s->labeled.push_back(v);
+				s->labeledDistances.push_back(d);
+
+				for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+					int w = heads[a];
+					double dw = d + weights[a];
+
+					if (s->reached[w] != s->stamp || dw < s->distance[w]) {
+						bool first = s->reached[w] != s->stamp;
+
+						s->reached[w] = s->stamp;
+						s->distance[w] = dw;
+						if (!unweighted) {
+							s->heap.push_back(Entry(dw, w));
+							push_heap(s->heap.begin(), s->heap.end(), greater<Entry>());
+						} else if (first) {
+							s->queue[tail++] = w;
+						}
+					}
+				}
+			}
+
+			for (int i = 0; i < (int) rootLabel.hubs.size(); i++) {
+				s->rootLabel[rootLabel.hubs[i]] = numeric_limits<double>::infinity();
+			}
+		}
+	};
+
+	static void flatten(
+		vector<Label>& labels,
+		vector<int>& offsets,
+		vector<int>& hubs,
+		vector<double>& distances)
+	{
+		int n = labels.size();
+		offsets.resize(n + 1);
+		offsets[0] = 0;
+
+		for (int v = 0; v < n; v++) {
+			offsets[v + 1] = offsets[v] + labels[v].hubs.size() + 1;
+		}
+
+		hubs.resize(offsets[n]);
+		distances.resize(offsets[n]);
+
+		for (int v = 0; v < n; v++) {
+			copy(labels[v].hubs.begin(), labels[v].hubs.end(), hubs.begin() + offsets[v]);
+			copy(labels[v].distances.begin(), labels[v].distances.end(),
+				distances.begin() + offsets[v]);
+			hubs[offsets[v + 1] - 1] = INT_MAX;
+			distances[offsets[v + 1] - 1] = numeric_limits<double>::infinity();
+
+			vector<int>().swap(labels[v].hubs);
+			vector<double>().swap(labels[v].distances);
+		}
+	}
+
+	int indexOf(V* v)
+	{
+		typename map<V*, int>::iterator it = vertexIndex.find(v);
+
+		if (it == vertexIndex.end()) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return it->second;
+	}
+
+	/**
+	 * Returns whether the arrays form one label per vertex whose hubs are
+	 * valid ids in ascending order, terminated by the sentinel, as the merge
+	 * in {@link #intersect} requires.
+	 */
+	bool isLabeling(
+		const vector<int>& offsets,
+		const vector<int>& hubs,
+		const vector<double>& distances)
+	{
+		int size = hubs.size();
+
+		if ((int) offsets.size() != vertexCount + 1 || offsets[0] != 0
+			|| offsets[vertexCount] != size || (int) distances.size() != size)
+		{
+			return false;
+		}
+
+		// every label holds at least the sentinel
+		for (int v = 0; v < vertexCount; v++) {
+			if (offsets[v] >= offsets[v + 1]) {
+				return false;
+			}
+		}
+
+		for (int v = 0; v < vertexCount; v++) {
+			int begin = offsets[v];
+			int end = offsets[v + 1];
+
+			if (hubs[end - 1] != INT_MAX) {
+				return false;
+			}
+
+			for (int i = begin; i < end - 1; i++) {
+				if (hubs[i] < 0 || hubs[i] >= vertexCount || (i > begin && hubs[i] <= hubs[i - 1])) {
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	template <class T>
+	static void writeArray(ostream& out, const T* data, int size)
+	{
+		out.write((const char*) data, (long) size * sizeof(T));
+	}
+
+	template <class T>
+	static void write(ostream& out, const vector<T>& data)
+	{
+		int size = data.size();
+		writeArray(out, &size, 1);
+		if (size > 0) {
+			writeArray(out, &data[0], size);
+		}
+	}
+
+	template <class T>
+	static void readArray(istream& in, T* data, int size)
+	{
+		in.read((char*) data, (long) size * sizeof(T));
+
+		if (!in) {
+			throw new invalid_argument("Unexpected end of hub labels");
+		}
+	}
+
+	template <class T>
+	static void read(istream& in, vector<T>& data)
+	{
+		int size;
+		readArray(in, &size, 1);
+
+		if (size < 0) {
+			throw new invalid_argument("Malformed hub labels");
+		}
+
+		// grow the array while reading, so that a corrupt size fails at the
+		// end of the stream instead of allocating it at once
+		const int chunk = 65536;
+
+		data.clear();
+		for (int done = 0; done < size; done += chunk) {
+			int count = size - done < chunk ? size - done : chunk;
+
+			data.resize(done + count);
+			readArray(in, &data[done], count);
+		}
+	}
+};
+
+#endif /* HUBLABELING_H_ */
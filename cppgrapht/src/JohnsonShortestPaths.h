@@ -0,0 +1,223 @@
+#ifndef JOHNSONSHORTESTPATHS_H_
+#define JOHNSONSHORTESTPATHS_H_
+
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include <BellmanFordShortestPath.h>
+#include <CSRGraph.h>
+#include <CSRSearch.h>
+#include <GraphPath.h>
+#include <GraphPathImpl.h>
+#include <WeightedGraph.h>
+
+/**
+ * <a href="http://en.wikipedia.org/wiki/Johnson%27s_algorithm">Johnson's
+ * algorithm</a> for all-pairs shortest paths in sparse graphs with negative
+ * edge weights but no negative cycles.
+ *
+ * <p>A single {@link BellmanFordShortestPath} run from a virtual vertex
+ * yields a potential <code>h</code> with which every edge weight <code>w(u,
+ * v) + h(u) - h(v)</code> becomes non-negative. The distances of every source
+ * are then found by Dijkstra's algorithm on the reweighted {@link CSRGraph}
+ * snapshot; with OpenMP the sources are spread over all threads, each one
+ * with its own {@link CSRSearch}.</p>
+ *
+ * <p>The <code>n x n</code> distance matrix is never materialized. Instead
+ * {@link #run} hands the distances of every source to a callback as soon as
+ * they are known. A callback <code>C</code> provides</p>
+ *
+ * <pre>
+ * void operator()(V* source, const vector&lt;double&gt;&amp; distances);
+ * </pre>
+ *
+ * <p>where <code>distances</code> is indexed by the vertex ids of {@link
+ * #getVertices} and holds infinity for unreachable vertices. The vector is
+ * only valid during the call. The callback is invoked concurrently from
+ * several threads when compiled with OpenMP and must be thread-safe.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class JohnsonShortestPaths
+{
+public:
+	WeightedGraph<V, E>* graph;
+
+	/**
+	 * The snapshot with reweighted, non-negative weights.
+	 */
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * The potential of every vertex.
+	 */
+	vector<double> potential;
+
+	/**
+	 * Reweights the specified graph.
+	 *
+	 * @param graph the graph
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 * @throws logic_error if the graph contains a negative-weight cycle.
+	 */
+	JohnsonShortestPaths(WeightedGraph<V, E>* graph)
+	{
+		this->graph = graph;
+		csr = new CSRGraph<V, E>(graph);
+
+		int n = csr->vertexCount;
+		potential.assign(n, 0.0);
+
+		if (csr->hasNegativeEdgeWeight()) {
+			BellmanFordShortestPath<V, E> bellmanFord(graph, NULL);
+
+			if (bellmanFord.hasNegativeCycle()) {
+				delete csr;
+				throw new logic_error("Graph contains a negative-weight cycle");
+			}
+
+			for (int v = 0; v < n; v++) {
+				potential[v] = bellmanFord.getCost(csr->vertices[v]);
+			}
+		}
+
+		for (int u = 0; u < n; u++) {
+			for (int a = csr->outOffsets[u]; a < csr->outOffsets[u + 1]; a++) {
+				double w = csr->outWeights[a] + potential[u] - potential[csr->outTargets[a]];
+
+				// rounding may leave tiny negative values on tight edges
+				csr->outWeights[a] = w < 0.0 ? 0.0 : w;
+			}
+		}
+	}
+
+	virtual ~JohnsonShortestPaths()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Returns the vertices, indexed by the ids used for the distances passed
+	 * to the callback.
+	 *
+	 * @return the vertices in id order
+	 */
+	const vector<V*>* getVertices()
+	{
+		return &csr->vertices;
+	}
+
+	/**
+	 * Computes the distances from every vertex and passes them to the
+	 * callback, one source at a time.
+	 *
+	 * @param callback receives the distances of each source
+	 */
+	template <class C>
+	void run(C& callback)
+	{
+		vector<int> sources(csr->vertexCount);
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			sources[v] = v;
+		}
+
+		run(sources, callback);
+	}
+
+	/**
+	 * Computes the distances from the specified sources and passes them to
+	 * the callback, one source at a time.
+	 *
+	 * @param sourceVertices the sources
+	 * @param callback receives the distances of each source
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	template <class C>
+	void run(list<V*>* sourceVertices, C& callback)
+	{
+		vector<int> sources;
+		typename list<V*>::iterator it;
+
+		for (it = sourceVertices->begin(); it != sourceVertices->end(); ++it) {
+			sources.push_back(indexOf(*it));
+		}
+
+		run(sources, callback);
+	}
+
+	/**
+	 * Calculates (and returns) the shortest path between two vertices.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return the shortest path, or <code>NULL</code> if no path exists.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	GraphPath<V, E>* getShortestPath(V* sourceVertex, V* targetVertex)
+	{
+		int s = indexOf(sourceVertex);
+		int t = indexOf(targetVertex);
+		CSRSearch<V, E> search(csr);
+		ZeroHeuristic h;
+
+		if (!search.run(s, t, h)) {
+			return NULL;
+		}
+
+		GraphPath<V, E>* reweighted = search.getPath(t);
+		list<E*>* edgeList = new list<E*>(*reweighted->getEdgeList());
+		delete reweighted;
+
+		return new GraphPathImpl<V, E>(
+			graph, sourceVertex, targetVertex, edgeList,
+			search.distance[t] - potential[s] + potential[t]);
+	}
+
+private:
+	int indexOf(V* v)
+	{
+		int id = csr->indexOf(v);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return id;
+	}
+
+	template <class C>
+	void run(const vector<int>& sources, C& callback)
+	{
+		int n = csr->vertexCount;
+		int count = sources.size();
+
+		#pragma omp parallel
+		{
+			CSRSearch<V, E> search(csr);
+			vector<double> distances(n);
+
+			#pragma omp for schedule(dynamic, 1)
+			for (int i = 0; i < count; i++) {
+				int s = sources[i];
+				search.runAll(s);
+
+				for (int v = 0; v < n; v++) {
+					distances[v] = search.isReached(v)
+						? search.distance[v] - potential[s] + potential[v]
+						: numeric_limits<double>::infinity();
+				}
+
+				callback(csr->vertices[s], distances);
+			}
+		}
+	}
+};
+
+#endif /* JOHNSONSHORTESTPATHS_H_ */
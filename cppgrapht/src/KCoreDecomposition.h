@@ -0,0 +1,415 @@
+#ifndef KCOREDECOMPOSITION_H_
+#define KCOREDECOMPOSITION_H_
+
+#include <map>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+#include <MaskSubgraph.h>
+
+/**
+ * The k-core decomposition of a graph: the k-core is the largest subgraph in
+ * which every vertex has at least <code>k</code> neighbours, and the core
+ * number of a vertex the largest <code>k</code> such that it belongs to the
+ * k-core. Edge directions are ignored, parallel edges count once and
+ * self-loops not at all.
+ *
+ * <p>{@link #run} implements the bucket algorithm of Batagelj and
+ * Zaversnik ("An O(m) Algorithm for Cores Decomposition of Networks",
+ * 2003): the vertices are kept sorted by their remaining degree in an array
+ * with the start of every degree bucket, and the vertex of least degree is
+ * removed repeatedly, moving each neighbour of higher degree one bucket down
+ * by a swap. It runs in <code>O(n + m)</code>.</p>
+ *
+ * <p>{@link #runParallel} peels level by level instead: every vertex left
+ * whose degree is at most <code>k</code> is removed at level <code>k</code>,
+ * together with the neighbours whose degree drops to <code>k</code> in turn.
+ * The vertices of a round are processed in parallel when compiled with
+ * OpenMP, decrementing the degrees of their neighbours atomically; the one
+ * decrement reaching <code>k</code> claims the neighbour for the next round.
+ * Levels without any vertex are skipped.</p>
+ *
+ * <p>Both orders of removal are degeneracy orderings. {@link #getCore}
+ * returns the k-core as a {@link MaskSubgraph} of the graph, which reads the
+ * core numbers of this decomposition instead of copying anything.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class KCoreDecomposition
+{
+public:
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * The distinct neighbours of every vertex other than itself, in the range
+	 * <code>[offsets[v], offsets[v + 1])</code> of <code>neighbors</code>.
+	 */
+	vector<int> offsets;
+	vector<int> neighbors;
+
+	/**
+	 * Core number of every vertex by id.
+	 */
+	vector<int> core;
+
+	/**
+	 * The vertex ids in the order they were removed.
+	 */
+	vector<int> order;
+
+	int degeneracy;
+
+	/**
+	 * Prepares the decomposition of the specified graph.
+	 *
+	 * @param g the graph
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	KCoreDecomposition(Graph<V, E>* g)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+		ownsSnapshot = true;
+		calculated = false;
+
+		simplify();
+	}
+
+	/**
+	 * Prepares the decomposition of an existing undirected snapshot, which
+	 * is neither copied nor deleted.
+	 *
+	 * @param snapshot undirected snapshot of the graph
+	 *
+	 * @throws invalid_argument if the snapshot is directed.
+	 */
+	KCoreDecomposition(CSRGraph<V, E>* snapshot)
+	{
+		if (snapshot->directed) {
+			throw new invalid_argument("Snapshot must be undirected");
+		}
+
+		graph = snapshot->graph;
+		csr = snapshot;
+		ownsSnapshot = false;
+		calculated = false;
+
+		simplify();
+	}
+
+	virtual ~KCoreDecomposition()
+	{
+		if (ownsSnapshot) {
+			delete csr;
+		}
+	}
+
+	/**
+	 * Computes the core numbers sequentially in linear time.
+	 */
+	void run()
+	{
+		int n = csr->vertexCount;
+		int maxDegree = 0;
+		vector<int> degree(n);
+
+		for (int v = 0; v < n; v++) {
+			degree[v] = degreeOf(v);
+			if (degree[v] > maxDegree) {
+				maxDegree = degree[v];
+			}
+		}
+
+		// bin[d] is the start of the vertices of degree d in vert, and pos
+		// the position of every vertex in it
+		vector<int> bin(maxDegree + 1, 0);
+		vector<int> vert(n);
+		vector<int> pos(n);
+
+		for (int v = 0; v < n; v++) {
+			bin[degree[v]]++;
+		}
+
+		int start = 0;
+
+		for (int d = 0; d <= maxDegree; d++) {
+			int count = bin[d];
+
+			bin[d] = start;
+			start += count;
+		}
+		for (int v = 0; v < n; v++) {
+			pos[v] = bin[degree[v]]++;
+			vert[pos[v]] = v;
+		}
+		for (int d = maxDegree; d > 0; d--) {
+			bin[d] = bin[d - 1];
+		}
+		bin[0] = 0;
+
+		for (int i = 0; i < n; i++) {
+			int v = vert[i];
+
+			for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+				int u = neighbors[a];
+
+				if (degree[u] > degree[v]) {
+					// swap u with the first vertex of its bucket, which then
+					// starts one later
+					int du = degree[u];
+					int pu = pos[u];
+					int pw = bin[du];
+					int w = vert[pw];
+
+					if (u != w) {
+						pos[u] = pw;
+						vert[pu] = w;
+						pos[w] = pu;
+						vert[pw] = u;
+					}
+
+					bin[du]++;
+					degree[u]--;
+				}
+			}
+		}
+
+		core.swap(degree);
+		order.swap(vert);
+		finish();
+	}
+
+	/**
+	 * Computes the core numbers by parallel peeling.
+	 */
+	void runParallel()
+	{
+		int n = csr->vertexCount;
+		vector<int> degree(n);
+		vector<int> remaining;
+		vector<char> removed(n, 0);
+		vector<int> frontier;
+		int level = n;
+
+		for (int v = 0; v < n; v++) {
+			degree[v] = degreeOf(v);
+			remaining.push_back(v);
+			if (degree[v] < level) {
+				level = degree[v];
+			}
+		}
+
+		core.assign(n, 0);
+		order.clear();
+		order.reserve(n);
+
+		while (!remaining.empty()) {
+			frontier.clear();
+			for (int i = 0; i < (int) remaining.size(); i++) {
+				int v = remaining[i];
+
+				if (degree[v] <= level) {
+					frontier.push_back(v);
+					removed[v] = 1;
+				}
+			}
+
+			while (!frontier.empty()) {
+				int count = frontier.size();
+				vector<int> next;
+
+				#pragma omp parallel
+				{
+					vector<int> local;
+
+					#pragma omp for schedule(dynamic, 64) nowait
+					for (int i = 0; i < count; i++) {
+						int v = frontier[i];
+
+						core[v] = level;
+
+						for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+							int u = neighbors[a];
+
+							if (!removed[u] && __sync_fetch_and_sub(&degree[u], 1) == level + 1) {
+								local.push_back(u);
+							}
+						}
+					}
+
+					#pragma omp critical
+					{
+						next.insert(next.end(), local.begin(), local.end());
+					}
+				}
+
+				order.insert(order.end(), frontier.begin(), frontier.end());
+
+				for (int i = 0; i < (int) next.size(); i++) {
+					removed[next[i]] = 1;
+				}
+
+				frontier.swap(next);
+			}
+
+			// drop the removed vertices and skip to the least degree left,
+			// which exceeds the level now
+			int kept = 0;
+			int least = n;
+
+			for (int i = 0; i < (int) remaining.size(); i++) {
+				int v = remaining[i];
+
+				if (!removed[v]) {
+					remaining[kept++] = v;
+					if (degree[v] < least) {
+						least = degree[v];
+					}
+				}
+			}
+
+			remaining.resize(kept);
+			level = least;
+		}
+
+		finish();
+	}
+
+	/**
+	 * Returns the core number of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return core number of the vertex
+	 *
+	 * @throws logic_error if the decomposition was not computed yet.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	int getCoreNumber(V* vertex)
+	{
+		checkCalculated();
+
+		int v = csr->indexOf(vertex);
+
+		if (v < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return core[v];
+	}
+
+	/**
+	 * Returns the core numbers of all vertices.
+	 *
+	 * @return map from the vertices to their core number
+	 *
+	 * @throws logic_error if the decomposition was not computed yet.
+	 */
+	map<V*, int>* getCoreNumbers()
+	{
+		checkCalculated();
+
+		map<V*, int>* numbers = new map<V*, int>();
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			(*numbers)[csr->vertices[v]] = core[v];
+		}
+
+		return numbers;
+	}
+
+	/**
+	 * Returns the degeneracy of the graph, the largest core number.
+	 *
+	 * @return degeneracy, <code>0</code> for the empty graph
+	 *
+	 * @throws logic_error if the decomposition was not computed yet.
+	 */
+	int getDegeneracy()
+	{
+		checkCalculated();
+
+		return degeneracy;
+	}
+
+	/**
+	 * Returns the k-core as a view of the graph. The view reads the core
+	 * numbers of this decomposition, so it must not outlive it nor be used
+	 * across runs.
+	 *
+	 * @param k order of the core
+	 *
+	 * @return the k-core, empty if <code>k</code> exceeds the degeneracy
+	 *
+	 * @throws logic_error if the decomposition was not computed yet.
+	 */
+	MaskSubgraph<V, E>* getCore(int k)
+	{
+		checkCalculated();
+
+		return new MaskSubgraph<V, E>(graph, &csr->vertexIndex, &core, k);
+	}
+
+private:
+	bool ownsSnapshot;
+	bool calculated;
+
+	void checkCalculated()
+	{
+		if (!calculated) {
+			throw new logic_error("Core decomposition has not been calculated");
+		}
+	}
+
+	int degreeOf(int v)
+	{
+		return offsets[v + 1] - offsets[v];
+	}
+
+	/**
+	 * Copies the arcs of the snapshot without duplicates and self-loops,
+	 * marking the neighbours already taken by the vertex at hand.
+	 */
+	void simplify()
+	{
+		int n = csr->vertexCount;
+		vector<int> mark(n, -1);
+
+		offsets.assign(1, 0);
+		neighbors.reserve(csr->outTargets.size());
+
+		for (int v = 0; v < n; v++) {
+			mark[v] = v;
+
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				int w = csr->outTargets[a];
+
+				if (mark[w] != v) {
+					mark[w] = v;
+					neighbors.push_back(w);
+				}
+			}
+
+			offsets.push_back(neighbors.size());
+		}
+	}
+
+	void finish()
+	{
+		degeneracy = 0;
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			if (core[v] > degeneracy) {
+				degeneracy = core[v];
+			}
+		}
+
+		calculated = true;
+	}
+};
+
+#endif /* KCOREDECOMPOSITION_H_ */
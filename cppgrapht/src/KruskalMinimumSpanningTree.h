@@ -0,0 +1,295 @@
+#ifndef KRUSKALMINIMUMSPANNINGTREE_H_
+#define KRUSKALMINIMUMSPANNINGTREE_H_
+
+#include <algorithm>
+#include <set>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * Kruskal's algorithm computing a minimum spanning forest of a weighted
+ * graph; edge directions are ignored. Among edges of equal weight the one
+ * with the lower edge id of the {@link CSRGraph} snapshot is preferred, so
+ * the result is unique.
+ *
+ * <p>Instead of sorting all edges up front the edges are handled by
+ * Filter-Kruskal (Osipov, Sanders and Singler, "The Filter-Kruskal Minimum
+ * Spanning Tree Algorithm", 2009): the edges are split at a pivot weight,
+ * the lighter half is processed first, and every heavier edge whose end
+ * points are already connected by then is dropped before it is ever sorted.
+ * Small sets of edges are sorted by a parallel merge sort of their (weight,
+ * id) keys and scanned by plain Kruskal. Filtering and sorting run in
+ * parallel when compiled with OpenMP; the union-find itself is
+ * sequential.</p>
+ *
+ * @see BoruvkaMinimumSpanningTree
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class KruskalMinimumSpanningTree
+{
+public:
+	/**
+	 * Edge sets up to this size per vertex are sorted instead of split.
+	 */
+	static const int BASE_CASE_FACTOR = 4;
+
+	/**
+	 * Number of keys each thread sorts by itself before merging.
+	 */
+	static const int SORT_CHUNK = 65536;
+
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * Edge ids of the spanning forest, in the order they were chosen.
+	 */
+	vector<int> treeEdges;
+
+	double totalWeight;
+
+	/**
+	 * Computes a minimum spanning forest of the specified graph.
+	 *
+	 * @param g the graph
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	KruskalMinimumSpanningTree(Graph<V, E>* g)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+		ownsSnapshot = true;
+
+		run();
+	}
+
+	/**
+	 * Computes a minimum spanning forest from the edge arrays of an existing
+	 * snapshot, which is neither copied nor deleted.
+	 *
+	 * @param snapshot snapshot of the graph
+	 */
+	KruskalMinimumSpanningTree(CSRGraph<V, E>* snapshot)
+	{
+		graph = snapshot->graph;
+		csr = snapshot;
+		ownsSnapshot = false;
+
+		run();
+	}
+
+	virtual ~KruskalMinimumSpanningTree()
+	{
+		if (ownsSnapshot) {
+			delete csr;
+		}
+	}
+
+	/**
+	 * Returns the edges of the minimum spanning forest.
+	 *
+	 * @return set of the tree edges
+	 */
+	set<E*>* getMinimumSpanningTreeEdgeSet()
+	{
+		set<E*>* edgeSet = new set<E*>();
+
+		for (int i = 0; i < (int) treeEdges.size(); i++) {
+			edgeSet->insert(csr->edges[treeEdges[i]]);
+		}
+
+		return edgeSet;
+	}
+
+	/**
+	 * Returns the total weight of the minimum spanning forest.
+	 *
+	 * @return sum of the weights of the tree edges
+	 */
+	double getMinimumSpanningTreeTotalWeight()
+	{
+		return totalWeight;
+	}
+
+private:
+	typedef pair<double, int> Key;
+
+	bool ownsSnapshot;
+	vector<int> parent;
+
+	void run()
+	{
+		int n = csr->vertexCount;
+		int m = csr->edgeCount;
+		vector<Key> keys(m);
+
+		parent.resize(n);
+		for (int v = 0; v < n; v++) {
+			parent[v] = v;
+		}
+
+		#pragma omp parallel for schedule(static)
+		for (int e = 0; e < m; e++) {
+			keys[e] = Key(csr->edgeWeights[e], e);
+		}
+
+		totalWeight = 0.0;
+		filterKruskal(keys);
+	}
+
+	int find(int v)
+	{
+		while (parent[v] != v) {
+			parent[v] = parent[parent[v]];
+			v = parent[v];
+		}
+
+		return v;
+	}
+
+	/**
+	 * Finds the root without shortening paths, so that threads may call it
+	 * concurrently.
+	 */
+	int findReadOnly(int v)
+	{
+		while (parent[v] != v) {
+			v = parent[v];
+		}
+
+		return v;
+	}
+
+	void filterKruskal(vector<Key>& keys)
+	{
+		int n = csr->vertexCount;
+
+		if ((int) treeEdges.size() == n - 1 || keys.empty()) {
+			return;
+		}
+
+		if ((long) keys.size() <= (long) BASE_CASE_FACTOR * n) {
+			parallelSort(keys);
+			kruskal(keys);
+			return;
+		}
+
+		// median of a few evenly spread weights
+		vector<Key> sample;
+		for (int i = 0; i < 15; i++) {
+			sample.push_back(keys[(long) keys.size() * i / 15]);
+		}
+		nth_element(sample.begin(), sample.begin() + 7, sample.end());
+		Key pivot = sample[7];
+
+		vector<Key> light;
+		vector<Key> heavy;
+
+		for (int i = 0; i < (int) keys.size(); i++) {
+			if (keys[i] <= pivot) {
+				light.push_back(keys[i]);
+			} else {
+				heavy.push_back(keys[i]);
+			}
+		}
+
+		vector<Key>().swap(keys);
+
+		if (heavy.empty()) {
+			// the pivot was the heaviest key, splitting makes no progress
+			parallelSort(light);
+			kruskal(light);
+			return;
+		}
+
+		filterKruskal(light);
+		vector<Key>().swap(light);
+
+		filter(heavy);
+		filterKruskal(heavy);
+	}
+
+	void kruskal(vector<Key>& keys)
+	{
+		int n = csr->vertexCount;
+
+		for (int i = 0; i < (int) keys.size() && (int) treeEdges.size() < n - 1; i++) {
+			int e = keys[i].second;
+			int u = find(csr->edgeSources[e]);
+			int v = find(csr->edgeTargets[e]);
+
+			if (u != v) {
+				parent[u] = v;
+				treeEdges.push_back(e);
+				totalWeight += keys[i].first;
+			}
+		}
+	}
+
+	/**
+	 * Drops the edges whose end points are already connected.
+	 */
+	void filter(vector<Key>& keys)
+	{
+		int m = keys.size();
+		vector<char> keep(m);
+
+		#pragma omp parallel for schedule(dynamic, 4096)
+		for (int i = 0; i < m; i++) {
+			int e = keys[i].second;
+
+			keep[i] = findReadOnly(csr->edgeSources[e]) != findReadOnly(csr->edgeTargets[e]);
+		}
+
+		int kept = 0;
+		for (int i = 0; i < m; i++) {
+			if (keep[i]) {
+				keys[kept++] = keys[i];
+			}
+		}
+
+		keys.resize(kept);
+	}
+
+	/**
+	 * Sorts chunks of the keys in parallel, then merges neighboring runs
+	 * pairwise, all merges of a round in parallel.
+	 */
+	void parallelSort(vector<Key>& keys)
+	{
+		long m = keys.size();
+		long chunks = (m + SORT_CHUNK - 1) / SORT_CHUNK;
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (long c = 0; c < chunks; c++) {
+			long end = (c + 1) * SORT_CHUNK < m ? (c + 1) * SORT_CHUNK : m;
+
+			sort(keys.begin() + c * SORT_CHUNK, keys.begin() + end);
+		}
+
+		vector<Key> buffer(m);
+
+		for (long width = SORT_CHUNK; width < m; width *= 2) {
+			long pairs = (m + 2 * width - 1) / (2 * width);
+
+			#pragma omp parallel for schedule(dynamic, 1)
+			for (long p = 0; p < pairs; p++) {
+				long begin = p * 2 * width;
+				long middle = begin + width < m ? begin + width : m;
+				long end = begin + 2 * width < m ? begin + 2 * width : m;
+
+				merge(
+					keys.begin() + begin, keys.begin() + middle,
+					keys.begin() + middle, keys.begin() + end,
+					buffer.begin() + begin);
+			}
+
+			keys.swap(buffer);
+		}
+	}
+};
+
+#endif /* KRUSKALMINIMUMSPANNINGTREE_H_ */
@@ -0,0 +1,402 @@
+#ifndef LABELPROPAGATIONCOMMUNITYDETECTION_H_
+#define LABELPROPAGATIONCOMMUNITYDETECTION_H_
+
+#include <list>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * Fast approximate community detection by label propagation (Raghavan,
+ * Albert and Kumara, "Near linear time algorithm to detect community
+ * structures in large-scale networks", 2007). Every vertex starts with a
+ * label of its own and repeatedly adopts the label of largest total edge
+ * weight among its neighbours, until the labels settle; the vertices
+ * sharing a label form a community. The graph is treated as undirected,
+ * the weights are those of {@link Graph#getEdgeWeight} and self-loops are
+ * ignored.
+ *
+ * <p>The updates are asynchronous: every iteration visits the vertices in a
+ * new random order and a vertex sees the labels its neighbours adopted
+ * earlier in the same iteration. The vertices run in parallel when compiled
+ * with OpenMP, reading and writing the shared labels without locks. Every
+ * thread counts the labels of a neighbourhood in its own open addressing
+ * hash table, sized to the largest degree, which is reset by clearing only
+ * the slots used.</p>
+ *
+ * <p>A vertex keeps its label if it is among the heaviest ones; otherwise ties
+ * are broken by a hash of the label, the vertex and the iteration, which
+ * avoids both a shared random number generator and a bias towards small
+ * labels. The iterations stop once the fraction of vertices changing their
+ * label drops to <code>threshold</code>, or after <code>maxIterations
+ * </code>.</p>
+ *
+ * <p>The community ids run from <code>0</code> to {@link
+ * #getCommunityCount} <code>- 1</code>, in order of the smallest vertex id
+ * of each community.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class LabelPropagationCommunityDetection
+{
+public:
+	static const int DEFAULT_MAX_ITERATIONS = 100;
+
+	static double defaultThreshold()
+	{
+		return 1e-3;
+	}
+
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	double threshold;
+	int maxIterations;
+
+	/**
+	 * Community id of every vertex, indexed by the vertex ids of the
+	 * snapshot.
+	 */
+	vector<int> community;
+
+	int communityCount;
+	int iterationCount;
+
+	/**
+	 * Prepares the label propagation on the specified graph.
+	 *
+	 * @param g the graph
+	 * @param threshold fraction of changed labels below which the
+	 * iterations stop
+	 * @param maxIterations upper bound on the iterations
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>, the
+	 * iteration bound is not positive or an edge weight is negative.
+	 */
+	LabelPropagationCommunityDetection(
+		Graph<V, E>* g,
+		double threshold = defaultThreshold(),
+		int maxIterations = DEFAULT_MAX_ITERATIONS)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+
+		if (maxIterations <= 0) {
+			delete csr;
+			throw new invalid_argument("Number of iterations must be positive");
+		}
+		for (int e = 0; e < csr->edgeCount; e++) {
+			if (csr->edgeWeights[e] < 0.0) {
+				delete csr;
+				throw new invalid_argument("Edge weights must not be negative");
+			}
+		}
+
+		this->threshold = threshold;
+		this->maxIterations = maxIterations;
+		calculated = false;
+	}
+
+	virtual ~LabelPropagationCommunityDetection()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Propagates the labels.
+	 *
+	 * @param seed seed of the random vertex orders and tie breaking
+	 */
+	void run(unsigned int seed = 1)
+	{
+		int n = csr->vertexCount;
+		int maxDegree = 0;
+		unsigned int random = seed;
+
+		community.resize(n);
+
+		for (int v = 0; v < n; v++) {
+			community[v] = v;
+			if (csr->outDegreeOf(v) > maxDegree) {
+				maxDegree = csr->outDegreeOf(v);
+			}
+		}
+
+		vector<int> order(n);
+
+		for (int v = 0; v < n; v++) {
+			order[v] = v;
+		}
+
+		iterationCount = 0;
+
+		while (iterationCount < maxIterations && n > 0) {
+			for (int i = n - 1; i > 0; i--) {
+				random = random * 1103515245u + 12345u;
+
+				int j = (int) ((random >> 8) % (unsigned int) (i + 1));
+				int t = order[i];
+
+				order[i] = order[j];
+				order[j] = t;
+			}
+
+			unsigned int salt = random ^ (unsigned int) iterationCount * 0x9e3779b9u;
+			int changed = 0;
+
+			#pragma omp parallel
+			{
+				Scratch scratch(maxDegree);
+
+				#pragma omp for schedule(dynamic, 256) reduction(+:changed) nowait
+				for (int i = 0; i < n; i++) {
+					int v = order[i];
+					int label = bestLabel(v, scratch, salt);
+
+					if (label != community[v]) {
+						community[v] = label;
+						changed++;
+					}
+				}
+			}
+
+			iterationCount++;
+
+			if (changed <= threshold * n) {
+				break;
+			}
+		}
+
+		communityCount = compact(community);
+		calculated = true;
+	}
+
+	/**
+	 * Returns the number of communities.
+	 *
+	 * @return the number of communities
+	 *
+	 * @throws logic_error if the labels were not propagated yet.
+	 */
+	int getCommunityCount()
+	{
+		checkCalculated();
+
+		return communityCount;
+	}
+
+	/**
+	 * Returns the number of iterations of the last run.
+	 *
+	 * @return the number of iterations
+	 *
+	 * @throws logic_error if the labels were not propagated yet.
+	 */
+	int getIterationCount()
+	{
+		checkCalculated();
+
+		return iterationCount;
+	}
+
+	/**
+	 * Returns the id of the community of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the community id
+	 *
+	 * @throws logic_error if the labels were not propagated yet.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	int getCommunityOf(V* vertex)
+	{
+		checkCalculated();
+
+		int v = csr->indexOf(vertex);
+
+		if (v < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return community[v];
+	}
+
+	/**
+	 * Returns the vertex sets of all communities, in the order of their ids.
+	 *
+	 * @return list of the communities
+	 *
+	 * @throws logic_error if the labels were not propagated yet.
+	 */
+	list<set<V*>*>* getCommunities()
+	{
+		checkCalculated();
+
+		vector<set<V*>*> sets(communityCount);
+
+		for (int c = 0; c < communityCount; c++) {
+			sets[c] = new set<V*>();
+		}
+		for (int v = 0; v < csr->vertexCount; v++) {
+			sets[community[v]]->insert(csr->vertices[v]);
+		}
+
+		return new list<set<V*>*>(sets.begin(), sets.end());
+	}
+
+private:
+	/**
+	 * The per-thread hash table from labels to their weight, with linear
+	 * probing and at most half of the slots in use.
+	 */
+	struct Scratch
+	{
+		vector<int> keys;
+		vector<double> weights;
+		vector<int> used;
+		unsigned int mask;
+		int shift;
+
+		Scratch(int maxDegree)
+		{
+			int capacity = 2;
+
+			shift = 31;
+			while (capacity < 2 * maxDegree) {
+				capacity *= 2;
+				shift--;
+			}
+
+			keys.assign(capacity, -1);
+			weights.assign(capacity, 0.0);
+			mask = capacity - 1;
+		}
+
+		void add(int label, double w)
+		{
+			unsigned int slot = ((unsigned int) label * 2654435761u) >> shift & mask;
+
+			while (keys[slot] != label) {
+				if (keys[slot] < 0) {
+					keys[slot] = label;
+					used.push_back(slot);
+					break;
+				}
+
+				slot = (slot + 1) & mask;
+			}
+
+			weights[slot] += w;
+		}
+
+		void clear()
+		{
+			for (int i = 0; i < (int) used.size(); i++) {
+				keys[used[i]] = -1;
+				weights[used[i]] = 0.0;
+			}
+
+			used.clear();
+		}
+	};
+
+	bool calculated;
+
+	void checkCalculated()
+	{
+		if (!calculated) {
+			throw new logic_error("Labels have not been propagated");
+		}
+	}
+
+	/**
+	 * Returns the heaviest label among the neighbours of the vertex, its own
+	 * label if that is among the heaviest or no neighbour weighs anything.
+	 */
+	int bestLabel(int v, Scratch& scratch, unsigned int salt)
+	{
+		int own = community[v];
+
+		for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+			int u = csr->outTargets[a];
+
+			if (u != v) {
+				scratch.add(community[u], csr->outWeights[a]);
+			}
+		}
+
+		int best = own;
+		double bestWeight = 0.0;
+		unsigned int bestTie = 0;
+
+		for (int i = 0; i < (int) scratch.used.size(); i++) {
+			int slot = scratch.used[i];
+			int label = scratch.keys[slot];
+			double w = scratch.weights[slot];
+
+			if (w <= 0.0 || w < bestWeight) {
+				continue;
+			}
+
+			unsigned int tie = mix((unsigned int) label ^ salt ^ (unsigned int) v * 0x85ebca6bu);
+
+			if (w > bestWeight || tie > bestTie) {
+				best = label;
+				bestWeight = w;
+				bestTie = tie;
+			}
+		}
+
+		for (int i = 0; i < (int) scratch.used.size(); i++) {
+			int slot = scratch.used[i];
+
+			if (scratch.keys[slot] == own && scratch.weights[slot] == bestWeight) {
+				best = own;
+			}
+		}
+
+		scratch.clear();
+
+		return best;
+	}
+
+	static unsigned int mix(unsigned int x)
+	{
+		x ^= x >> 16;
+		x *= 0x7feb352du;
+		x ^= x >> 15;
+		x *= 0x846ca68bu;
+		x ^= x >> 16;
+
+		return x;
+	}
+
+	/**
+	 * Renumbers the labels densely in order of their first occurrence.
+	 *
+	 * @return number of distinct labels
+	 */
+	static int compact(vector<int>& labels)
+	{
+		int n = labels.size();
+		vector<int> renamed(n, -1);
+		int count = 0;
+
+		for (int v = 0; v < n; v++) {
+			if (renamed[labels[v]] < 0) {
+				renamed[labels[v]] = count++;
+			}
+
+			labels[v] = renamed[labels[v]];
+		}
+
+		return count;
+	}
+};
+
+#endif /* LABELPROPAGATIONCOMMUNITYDETECTION_H_ */
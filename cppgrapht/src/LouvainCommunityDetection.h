@@ -0,0 +1,750 @@
+#ifndef LOUVAINCOMMUNITYDETECTION_H_
+#define LOUVAINCOMMUNITYDETECTION_H_
+
+#include <list>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * Community detection by modularity maximization with the Louvain method
+ * (Blondel et al., "Fast unfolding of communities in large networks", 2008)
+ * and optionally the refinement of the Leiden algorithm (Traag, Waltman and
+ * van Eck, "From Louvain to Leiden: guaranteeing well-connected
+ * communities", 2019). The graph is treated as undirected and weighted;
+ * parallel edges add up and a self-loop counts twice towards the degree of
+ * its vertex. The modularity of a partition with resolution <code>gamma
+ * </code> is the sum over its communities of <code>in / m - gamma * (vol /
+ * 2m)^2</code>, where <code>in</code> is the weight of the edges inside the
+ * community, <code>vol</code> the sum of the weighted degrees of its vertices
+ * and <code>m</code> the total edge weight.
+ *
+ * <p>Every level first moves vertices locally: in passes over the vertices in
+ * random order, every vertex joins the neighbouring community of largest
+ * modularity gain, until a pass gains less than <code>tolerance</code>. The
+ * vertices of a pass are moved in parallel when compiled with OpenMP,
+ * optimistically: every thread reads the communities of the neighbours as
+ * they are, without locks, and the community volumes are updated
+ * atomically. Every thread sums the weights towards the neighbouring
+ * communities in its own dense scratch array.</p>
+ *
+ * <p>With refinement, every community is then split into its singletons
+ * again, and each singleton which is well connected to the rest of the
+ * community joins the well connected subcommunity of largest non-negative
+ * gain, greedily rather than randomly. The communities are refined in
+ * parallel. The refined partition is aggregated, so that communities are
+ * only ever merged from connected parts, while the unrefined one is kept as
+ * the initial partition of the next level.</p>
+ *
+ * <p>Aggregation builds the graph of the next level as flat CSR arrays in
+ * parallel, one vertex per (refined) community, with the internal weights as
+ * self-loops. Levels repeat until nothing can be aggregated anymore.</p>
+ *
+ * <p>The community ids run from <code>0</code> to {@link
+ * #getCommunityCount} <code>- 1</code>, in order of the smallest vertex id
+ * of each community.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class LouvainCommunityDetection
+{
+public:
+	/**
+	 * Upper bound on the local moving passes per level.
+	 */
+	static const int MAX_PASSES = 100;
+
+	static double defaultTolerance()
+	{
+		return 1e-7;
+	}
+
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	double resolution;
+	bool refine;
+
+	/**
+	 * Least modularity gain of a local moving pass to continue with the
+	 * next one.
+	 */
+	double tolerance;
+
+	/**
+	 * Community id of every vertex, indexed by the vertex ids of the
+	 * snapshot.
+	 */
+	vector<int> community;
+
+	int communityCount;
+	double modularity;
+	int levelCount;
+
+	/**
+	 * Prepares the community detection on the specified graph.
+	 *
+	 * @param g the graph
+	 * @param resolution resolution of the modularity, higher values yielding
+	 * smaller communities
+	 * @param refine whether to refine the communities before aggregation as
+	 * in the Leiden algorithm
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>, the
+	 * resolution is negative or an edge weight is negative.
+	 */
+	LouvainCommunityDetection(Graph<V, E>* g, double resolution = 1.0, bool refine = true)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, false, false);
+
+		if (resolution < 0.0) {
+			delete csr;
+			throw new invalid_argument("Resolution must not be negative");
+		}
+		for (int e = 0; e < csr->edgeCount; e++) {
+			if (csr->edgeWeights[e] < 0.0) {
+				delete csr;
+				throw new invalid_argument("Edge weights must not be negative");
+			}
+		}
+
+		this->resolution = resolution;
+		this->refine = refine;
+		tolerance = defaultTolerance();
+		calculated = false;
+	}
+
+	virtual ~LouvainCommunityDetection()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Detects the communities.
+	 *
+	 * @param seed seed of the random vertex orders
+	 */
+	void run(unsigned int seed = 1)
+	{
+		int n = csr->vertexCount;
+		Level level;
+
+		buildFirstLevel(level);
+
+		double twoM = 0.0;
+
+		for (int v = 0; v < n; v++) {
+			twoM += level.volumes[v];
+		}
+
+		// membership maps the vertices of the graph to those of the level
+		vector<int> membership(n);
+		vector<int> comm(n);
+
+		for (int v = 0; v < n; v++) {
+			membership[v] = v;
+			comm[v] = v;
+		}
+
+		random = seed;
+		levelCount = 0;
+
+		while (level.n > 0 && twoM > 0.0) {
+			levelCount++;
+
+			moveLocally(level, comm, twoM);
+
+			vector<int> parts;
+			int partCount;
+
+			if (refine) {
+				partCount = refinePartition(level, comm, twoM, parts);
+			} else {
+				parts = comm;
+				partCount = compact(parts);
+			}
+
+			if (partCount == level.n) {
+				break;
+			}
+
+			Level next;
+			aggregate(level, parts, partCount, next);
+
+			vector<int> nextComm(partCount);
+
+			for (int v = 0; v < level.n; v++) {
+				nextComm[parts[v]] = comm[v];
+			}
+			for (int v = 0; v < n; v++) {
+				membership[v] = parts[membership[v]];
+			}
+
+			compact(nextComm);
+			comm.swap(nextComm);
+			swapLevels(level, next);
+		}
+
+		community.resize(n);
+		for (int v = 0; v < n; v++) {
+			community[v] = comm[membership[v]];
+		}
+
+		communityCount = compact(community);
+		modularity = computeModularity(community, communityCount);
+		calculated = true;
+	}
+
+	/**
+	 * Returns the number of communities.
+	 *
+	 * @return the number of communities
+	 *
+	 * @throws logic_error if the communities were not detected yet.
+	 */
+	int getCommunityCount()
+	{
+		checkCalculated();
+
+		return communityCount;
+	}
+
+	/**
+	 * Returns the modularity of the communities.
+	 *
+	 * @return modularity with the resolution of this detection, <code>0
+	 * </code> if the graph has no edge weight
+	 *
+	 * @throws logic_error if the communities were not detected yet.
+	 */
+	double getModularity()
+	{
+		checkCalculated();
+
+		return modularity;
+	}
+
+	/**
+	 * Returns the id of the community of the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the community id
+	 *
+	 * @throws logic_error if the communities were not detected yet.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	int getCommunityOf(V* vertex)
+	{
+		checkCalculated();
+
+		int v = csr->indexOf(vertex);
+
+		if (v < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return community[v];
+	}
+
+	/**
+	 * Returns the vertex sets of all communities, in the order of their ids.
+	 *
+	 * @return list of the communities
+	 *
+	 * @throws logic_error if the communities were not detected yet.
+	 */
+	list<set<V*>*>* getCommunities()
+	{
+		checkCalculated();
+
+		vector<set<V*>*> sets(communityCount);
+
+		for (int c = 0; c < communityCount; c++) {
+			sets[c] = new set<V*>();
+		}
+		for (int v = 0; v < csr->vertexCount; v++) {
+			sets[community[v]]->insert(csr->vertices[v]);
+		}
+
+		return new list<set<V*>*>(sets.begin(), sets.end());
+	}
+
+	/**
+	 * Returns the modularity of the specified partition of the graph with
+	 * the resolution of this detection.
+	 *
+	 * @param partition community id of every vertex by id, from <code>0
+	 * </code> to <code>count - 1</code>
+	 * @param count number of communities
+	 *
+	 * @return modularity of the partition
+	 */
+	double computeModularity(const vector<int>& partition, int count)
+	{
+		vector<double> inside(count, 0.0);
+		vector<double> volume(count, 0.0);
+		double total = 0.0;
+
+		for (int e = 0; e < csr->edgeCount; e++) {
+			int cu = partition[csr->edgeSources[e]];
+			int cv = partition[csr->edgeTargets[e]];
+			double w = csr->edgeWeights[e];
+
+			if (cu == cv) {
+				inside[cu] += w;
+			}
+
+			volume[cu] += w;
+			volume[cv] += w;
+			total += w;
+		}
+
+		if (total <= 0.0) {
+			return 0.0;
+		}
+
+		double q = 0.0;
+
+		for (int c = 0; c < count; c++) {
+			double share = volume[c] / (2.0 * total);
+
+			q += inside[c] / total - resolution * share * share;
+		}
+
+		return q;
+	}
+
+private:
+	/**
+	 * The graph of a level: arcs in both directions without self-loops,
+	 * the weight of the self-loops and the weighted degree of every vertex.
+	 */
+	struct Level
+	{
+		int n;
+		vector<int> offsets;
+		vector<int> targets;
+		vector<double> weights;
+		vector<double> loops;
+		vector<double> volumes;
+	};
+
+	/**
+	 * The per-thread weights towards the communities seen from a vertex.
+	 */
+	struct Scratch
+	{
+		vector<double> weight;
+		vector<char> seen;
+		vector<int> touched;
+
+		Scratch(int n) : weight(n, 0.0), seen(n, 0)
+		{
+		}
+
+		void add(int c, double w)
+		{
+			if (!seen[c]) {
+				seen[c] = 1;
+				touched.push_back(c);
+			}
+
+			weight[c] += w;
+		}
+
+		void clear()
+		{
+			for (int i = 0; i < (int) touched.size(); i++) {
+				weight[touched[i]] = 0.0;
+				seen[touched[i]] = 0;
+			}
+
+			touched.clear();
+		}
+	};
+
+	bool calculated;
+	unsigned int random;
+
+	void checkCalculated()
+	{
+		if (!calculated) {
+			throw new logic_error("Communities have not been detected");
+		}
+	}
+
+	static void swapLevels(Level& a, Level& b)
+	{
+		int n = a.n;
+
+		a.n = b.n;
+		b.n = n;
+		a.offsets.swap(b.offsets);
+		a.targets.swap(b.targets);
+		a.weights.swap(b.weights);
+		a.loops.swap(b.loops);
+		a.volumes.swap(b.volumes);
+	}
+
+	void buildFirstLevel(Level& level)
+	{
+		int n = csr->vertexCount;
+
+		level.n = n;
+		level.offsets.assign(1, 0);
+		level.loops.assign(n, 0.0);
+		level.volumes.assign(n, 0.0);
+
+		for (int v = 0; v < n; v++) {
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				int u = csr->outTargets[a];
+				double w = csr->outWeights[a];
+
+				if (u == v) {
+					level.loops[v] += w;
+					level.volumes[v] += 2.0 * w;
+				} else {
+					level.targets.push_back(u);
+					level.weights.push_back(w);
+					level.volumes[v] += w;
+				}
+			}
+
+			level.offsets.push_back(level.targets.size());
+		}
+	}
+
+	/**
+	 * Returns a random permutation of <code>0</code> to <code>n - 1</code>.
+	 */
+	vector<int> shuffled(int n)
+	{
+		vector<int> order(n);
+
+		for (int i = 0; i < n; i++) {
+			order[i] = i;
+		}
+		for (int i = n - 1; i > 0; i--) {
+			random = random * 1103515245u + 12345u;
+
+			int j = (int) ((random >> 8) % (unsigned int) (i + 1));
+			int t = order[i];
+
+			order[i] = order[j];
+			order[j] = t;
+		}
+
+		return order;
+	}
+
+	void moveLocally(Level& level, vector<int>& comm, double twoM)
+	{
+		int n = level.n;
+		double scale = resolution / twoM;
+		vector<double> volume(n, 0.0);
+
+		for (int v = 0; v < n; v++) {
+			volume[comm[v]] += level.volumes[v];
+		}
+
+		for (int pass = 0; pass < MAX_PASSES; pass++) {
+			vector<int> order = shuffled(n);
+			double gain = 0.0;
+
+			#pragma omp parallel
+			{
+				Scratch scratch(n);
+
+				#pragma omp for schedule(dynamic, 256) reduction(+:gain) nowait
+				for (int i = 0; i < n; i++) {
+					int v = order[i];
+					int own = comm[v];
+					double vol = level.volumes[v];
+
+					for (int a = level.offsets[v]; a < level.offsets[v + 1]; a++) {
+						scratch.add(comm[level.targets[a]], level.weights[a]);
+					}
+
+					double stay = scratch.weight[own] - scale * vol * (volume[own] - vol);
+					double best = stay;
+					int target = own;
+
+					for (int k = 0; k < (int) scratch.touched.size(); k++) {
+						int c = scratch.touched[k];
+
+						if (c == own) {
+							continue;
+						}
+
+						double delta = scratch.weight[c] - scale * vol * volume[c];
+
+						if (delta > best) {
+							best = delta;
+							target = c;
+						}
+					}
+
+					scratch.clear();
+
+					if (target != own) {
+						#pragma omp atomic
+						volume[own] -= vol;
+						#pragma omp atomic
+						volume[target] += vol;
+
+						comm[v] = target;
+						gain += best - stay;
+					}
+				}
+			}
+
+			if (gain * 2.0 / twoM < tolerance) {
+				break;
+			}
+		}
+	}
+
+	/**
+	 * Refines every community of <code>comm</code> into well connected
+	 * subcommunities, written densely numbered to <code>parts</code>.
+	 *
+	 * @return number of subcommunities
+	 */
+	int refinePartition(Level& level, vector<int>& comm, double twoM, vector<int>& parts)
+	{
+		int n = level.n;
+		double scale = resolution / twoM;
+
+		// members of every community in random order
+		vector<int> start(n + 1, 0);
+		vector<int> members(n);
+		vector<int> order = shuffled(n);
+
+		for (int v = 0; v < n; v++) {
+			start[comm[v] + 1]++;
+		}
+		for (int c = 0; c < n; c++) {
+			start[c + 1] += start[c];
+		}
+
+		vector<int> next(start.begin(), start.end() - 1);
+
+		for (int i = 0; i < n; i++) {
+			int v = order[i];
+
+			members[next[comm[v]]++] = v;
+		}
+
+		parts.resize(n);
+
+		vector<double> volume(n);
+		vector<double> cut(n);
+		vector<char> merged(n, 0);
+
+		#pragma omp parallel
+		{
+			Scratch scratch(n);
+
+			#pragma omp for schedule(dynamic, 16)
+			for (int c = 0; c < n; c++) {
+				if (start[c] == start[c + 1]) {
+					continue;
+				}
+
+				double total = 0.0;
+
+				for (int i = start[c]; i < start[c + 1]; i++) {
+					int v = members[i];
+					double inside = 0.0;
+
+					for (int a = level.offsets[v]; a < level.offsets[v + 1]; a++) {
+						if (comm[level.targets[a]] == c) {
+							inside += level.weights[a];
+						}
+					}
+
+					parts[v] = v;
+					volume[v] = level.volumes[v];
+					cut[v] = inside;
+					total += level.volumes[v];
+				}
+
+				for (int i = start[c]; i < start[c + 1]; i++) {
+					int v = members[i];
+					double vol = level.volumes[v];
+
+					// only singletons well connected to their community move
+					if (parts[v] != v || merged[v] || cut[v] < scale * vol * (total - vol)) {
+						continue;
+					}
+
+					for (int a = level.offsets[v]; a < level.offsets[v + 1]; a++) {
+						int u = level.targets[a];
+
+						if (comm[u] == c) {
+							scratch.add(parts[u], level.weights[a]);
+						}
+					}
+
+					double best = 0.0;
+					int target = -1;
+
+					for (int k = 0; k < (int) scratch.touched.size(); k++) {
+						int r = scratch.touched[k];
+
+						if (r == v || cut[r] < scale * volume[r] * (total - volume[r])) {
+							continue;
+						}
+
+						double delta = scratch.weight[r] - scale * vol * volume[r];
+
+						if (delta >= best) {
+							best = delta;
+							target = r;
+						}
+					}
+
+					if (target >= 0) {
+						double w = scratch.weight[target];
+
+						parts[v] = target;
+						merged[target] = 1;
+						volume[target] += vol;
+						cut[target] += cut[v] - 2.0 * w;
+					}
+
+					scratch.clear();
+				}
+			}
+		}
+
+		return compact(parts);
+	}
+
+	/**
+	 * Builds the graph of the next level with one vertex per part.
+	 */
+	void aggregate(Level& level, vector<int>& parts, int count, Level& next)
+	{
+		int n = level.n;
+		vector<int> start(count + 1, 0);
+		vector<int> members(n);
+
+		for (int v = 0; v < n; v++) {
+			start[parts[v] + 1]++;
+		}
+		for (int p = 0; p < count; p++) {
+			start[p + 1] += start[p];
+		}
+
+		vector<int> fill(start.begin(), start.end() - 1);
+
+		for (int v = 0; v < n; v++) {
+			members[fill[parts[v]]++] = v;
+		}
+
+		next.n = count;
+		next.offsets.assign(count + 1, 0);
+		next.loops.assign(count, 0.0);
+		next.volumes.assign(count, 0.0);
+
+		// the first pass counts the neighbouring parts, the second one
+		// writes them
+		for (int round = 0; round < 2; round++) {
+			if (round == 1) {
+				for (int p = 0; p < count; p++) {
+					next.offsets[p + 1] += next.offsets[p];
+				}
+
+				next.targets.resize(next.offsets[count]);
+				next.weights.resize(next.offsets[count]);
+			}
+
+			#pragma omp parallel
+			{
+				Scratch scratch(count);
+
+				#pragma omp for schedule(dynamic, 64)
+				for (int p = 0; p < count; p++) {
+					double loop = 0.0;
+					double vol = 0.0;
+
+					for (int i = start[p]; i < start[p + 1]; i++) {
+						int v = members[i];
+
+						loop += level.loops[v];
+						vol += level.volumes[v];
+
+						for (int a = level.offsets[v]; a < level.offsets[v + 1]; a++) {
+							int q = parts[level.targets[a]];
+
+							if (q == p) {
+								// seen from both ends
+								loop += level.weights[a] / 2.0;
+							} else {
+								scratch.add(q, level.weights[a]);
+							}
+						}
+					}
+
+					if (round == 0) {
+						next.offsets[p + 1] = scratch.touched.size();
+						next.loops[p] = loop;
+						next.volumes[p] = vol;
+					} else {
+						int pos = next.offsets[p];
+
+						for (int k = 0; k < (int) scratch.touched.size(); k++) {
+							int q = scratch.touched[k];
+
+							next.targets[pos] = q;
+							next.weights[pos] = scratch.weight[q];
+							pos++;
+						}
+					}
+
+					scratch.clear();
+				}
+			}
+		}
+	}
+
+	/**
+	 * Renumbers the non-negative ids densely in order of their first
+	 * occurrence.
+	 *
+	 * @return number of distinct ids
+	 */
+	static int compact(vector<int>& ids)
+	{
+		int n = ids.size();
+		int bound = 0;
+		int count = 0;
+
+		for (int v = 0; v < n; v++) {
+			if (ids[v] >= bound) {
+				bound = ids[v] + 1;
+			}
+		}
+
+		vector<int> renamed(bound, -1);
+
+		for (int v = 0; v < n; v++) {
+			if (renamed[ids[v]] < 0) {
+				renamed[ids[v]] = count++;
+			}
+
+			ids[v] = renamed[ids[v]];
+		}
+
+		return count;
+	}
+};
+
+#endif /* LOUVAINCOMMUNITYDETECTION_H_ */
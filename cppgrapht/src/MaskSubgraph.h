@@ -0,0 +1,299 @@
+#ifndef MASKSUBGRAPH_H_
+#define MASKSUBGRAPH_H_
+
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <AbstractGraph.h>
+#include <Graph.h>
+
+#define UNMODIFIABLE_SUBGRAPH ("this subgraph is an unmodifiable view")
+
+/**
+ * An unmodifiable view of the subgraph of a backing graph induced by the
+ * vertices whose value reaches a threshold, such as the k-core of {@link
+ * KCoreDecomposition}. The values are looked up by vertex id through the
+ * given index and value array, which belong to the creator of the view and
+ * are not copied; neither is the backing graph. An edge belongs to the view
+ * if both of its endpoints do.
+ *
+ * <p>Queries read through to the backing graph and filter its answers. The
+ * edge and vertex sets, including the edges of a vertex, are built on their
+ * first request and kept, so the view assumes that neither the backing graph
+ * nor the values change while it is in use. Every modification throws a
+ * <code>domain_error</code>.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class MaskSubgraph : public AbstractGraph<V, E>
+{
+public:
+	Graph<V, E>* base;
+	const map<V*, int>* index;
+	const vector<int>* values;
+	int threshold;
+
+	/**
+	 * Creates a view of the vertices of the backing graph whose value is at
+	 * least the threshold.
+	 *
+	 * @param base the backing graph
+	 * @param index id of every vertex of the backing graph
+	 * @param values value of every vertex by id
+	 * @param threshold least value of the vertices of the view
+	 *
+	 * @throws invalid_argument if any argument is <code>NULL</code>.
+	 */
+	MaskSubgraph(Graph<V, E>* base, const map<V*, int>* index, const vector<int>* values, int threshold)
+	{
+		if (base == NULL || index == NULL || values == NULL) {
+			throw new invalid_argument("NULL-pointer given for the backing graph or mask");
+		}
+
+		this->base = base;
+		this->index = index;
+		this->values = values;
+		this->threshold = threshold;
+
+		vertices = NULL;
+		edges = NULL;
+	}
+
+	virtual ~MaskSubgraph()
+	{
+		delete vertices;
+		delete edges;
+
+		typename map<V*, set<E*>* >::iterator it;
+		for (it = vertexEdges.begin(); it != vertexEdges.end(); ++it) {
+			delete it->second;
+		}
+	}
+
+	/**
+	 * @see Graph#getAllEdges(Object, Object)
+	 */
+	set<E*>* getAllEdges(V* sourceVertex, V* targetVertex)
+	{
+		if (!containsVertex(sourceVertex) || !containsVertex(targetVertex)) {
+			return NULL;
+		}
+
+		return base->getAllEdges(sourceVertex, targetVertex);
+	}
+
+	/**
+	 * @see Graph#getEdge(Object, Object)
+	 */
+	E* getEdge(V* sourceVertex, V* targetVertex)
+	{
+		if (!containsVertex(sourceVertex) || !containsVertex(targetVertex)) {
+			return NULL;
+		}
+
+		return base->getEdge(sourceVertex, targetVertex);
+	}
+
+	/**
+	 * @see Graph#getEdgeFactory()
+	 */
+	EdgeFactory<V, E>* getEdgeFactory()
+	{
+		return base->getEdgeFactory();
+	}
+
+	/**
+	 * @see Graph#addEdge(Object, Object)
+	 */
+	E* addEdge(V*, V*)
+	{
+		throw new domain_error(UNMODIFIABLE_SUBGRAPH);
+	}
+
+	/**
+	 * @see Graph#addEdge(Object, Object, Object)
+	 */
+	bool addEdge(V*, V*, E*)
+	{
+		throw new domain_error(UNMODIFIABLE_SUBGRAPH);
+	}
+
+	/**
+	 * @see Graph#addVertex(Object)
+	 */
+	bool addVertex(V*)
+	{
+		throw new domain_error(UNMODIFIABLE_SUBGRAPH);
+	}
+
+	/**
+	 * @see Graph#containsEdge(Object)
+	 */
+	bool containsEdge(E* e)
+	{
+		return base->containsEdge(e)
+			&& containsVertex(base->getEdgeSource(e))
+			&& containsVertex(base->getEdgeTarget(e));
+	}
+
+	/**
+	 * @see Graph#containsVertex(Object)
+	 */
+	bool containsVertex(V* v)
+	{
+		typename map<V*, int>::const_iterator it = index->find(v);
+
+		return it != index->end() && (*values)[it->second] >= threshold;
+	}
+
+	/**
+	 * @see Graph#edgeSet()
+	 */
+	const set<E*>* edgeSet()
+	{
+		if (edges == NULL) {
+			edges = new set<E*>();
+
+			const set<E*>* all = base->edgeSet();
+
+			typename set<E*>::const_iterator it;
+			for (it = all->begin(); it != all->end(); ++it) {
+				if (containsVertex(base->getEdgeSource(*it))
+					&& containsVertex(base->getEdgeTarget(*it)))
+				{
+					edges->insert(*it);
+				}
+			}
+		}
+
+		return edges;
+	}
+
+	/**
+	 * @see Graph#edgesOf(Object)
+	 */
+	const set<E*>* edgesOf(V* vertex)
+	{
+		this->assertVertexExist(vertex);
+
+		typename map<V*, set<E*>* >::iterator found = vertexEdges.find(vertex);
+
+		if (found != vertexEdges.end()) {
+			return found->second;
+		}
+
+		set<E*>* touching = new set<E*>();
+		const set<E*>* all = base->edgesOf(vertex);
+
+		typename set<E*>::const_iterator it;
+		for (it = all->begin(); it != all->end(); ++it) {
+			V* source = base->getEdgeSource(*it);
+			V* opposite = source == vertex ? base->getEdgeTarget(*it) : source;
+
+			if (containsVertex(opposite)) {
+				touching->insert(*it);
+			}
+		}
+
+		vertexEdges[vertex] = touching;
+
+		return touching;
+	}
+
+	/**
+	 * Returns the number of edges of the view touching the specified vertex,
+	 * self-loops counting twice, regardless of the direction of the edges.
+	 *
+	 * @param vertex vertex whose degree is to be calculated.
+	 *
+	 * @return the degree of the vertex in the view.
+	 */
+	int degreeOf(V* vertex)
+	{
+		const set<E*>* touching = edgesOf(vertex);
+		int degree = 0;
+
+		typename set<E*>::const_iterator it;
+		for (it = touching->begin(); it != touching->end(); ++it) {
+			degree += base->getEdgeSource(*it) == base->getEdgeTarget(*it) ? 2 : 1;
+		}
+
+		return degree;
+	}
+
+	/**
+	 * @see Graph#removeEdge(Object, Object)
+	 */
+	E* removeEdge(V*, V*)
+	{
+		throw new domain_error(UNMODIFIABLE_SUBGRAPH);
+	}
+
+	/**
+	 * @see Graph#removeEdge(Object)
+	 */
+	bool removeEdge(E*)
+	{
+		throw new domain_error(UNMODIFIABLE_SUBGRAPH);
+	}
+
+	/**
+	 * @see Graph#removeVertex(Object)
+	 */
+	bool removeVertex(V*)
+	{
+		throw new domain_error(UNMODIFIABLE_SUBGRAPH);
+	}
+
+	/**
+	 * @see Graph#vertexSet()
+	 */
+	const set<V*>* vertexSet()
+	{
+		if (vertices == NULL) {
+			vertices = new set<V*>();
+
+			typename map<V*, int>::const_iterator it;
+			for (it = index->begin(); it != index->end(); ++it) {
+				if ((*values)[it->second] >= threshold) {
+					vertices->insert(vertices->end(), it->first);
+				}
+			}
+		}
+
+		return vertices;
+	}
+
+	/**
+	 * @see Graph#getEdgeSource(Object)
+	 */
+	V* getEdgeSource(E* e)
+	{
+		return base->getEdgeSource(e);
+	}
+
+	/**
+	 * @see Graph#getEdgeTarget(Object)
+	 */
+	V* getEdgeTarget(E* e)
+	{
+		return base->getEdgeTarget(e);
+	}
+
+	/**
+	 * @see Graph#getEdgeWeight(Object)
+	 */
+	double getEdgeWeight(E* e)
+	{
+		return base->getEdgeWeight(e);
+	}
+
+private:
+	set<V*>* vertices;
+	set<E*>* edges;
+	map<V*, set<E*>* > vertexEdges;
+};
+
+#endif /* MASKSUBGRAPH_H_ */
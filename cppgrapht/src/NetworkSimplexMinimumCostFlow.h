@@ -0,0 +1,663 @@
+#ifndef NETWORKSIMPLEXMINIMUMCOSTFLOW_H_
+#define NETWORKSIMPLEXMINIMUMCOSTFLOW_H_
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * The primal network simplex algorithm computing a minimum cost flow: every
+ * vertex has a supply (positive) or demand (negative), every edge a capacity
+ * and a cost per unit of flow, and the flow has to satisfy all supplies and
+ * demands at least cost. Edges are always directed from source to target;
+ * parallel edges are independent arcs.
+ *
+ * <p>Capacities, costs and supplies are kept as columns indexed by the edge
+ * and vertex ids of a {@link CSRGraph} snapshot. They are either taken from
+ * maps, with missing capacities being infinite, missing supplies zero and
+ * missing costs falling back to the edge weights, or passed directly as
+ * columns.</p>
+ *
+ * <p>The basis is a spanning tree rooted in an artificial vertex connected to
+ * every vertex by an artificial arc of prohibitive cost (big-M method). The
+ * tree keeps parent, predecessor arc and potential of every vertex, and
+ * threads all vertices in preorder along with the subtree sizes. A pivot
+ * thus only walks the cycle and shifts the potentials of the moved subtree,
+ * a contiguous run of the thread, by one constant.</p>
+ *
+ * <p>The entering arc is chosen by block search (Grigoriadis, "An Efficient
+ * Implementation of the Network Simplex Method", 1986): the arcs are scanned
+ * cyclically in blocks of about <code>sqrt(m)</code>, and the most violating
+ * arc of the first block containing one enters. The leaving arc is chosen
+ * so that the tree stays strongly feasible, which prevents cycling.</p>
+ *
+ * <p>If artificial arcs still carry flow at the end, the supplies cannot be
+ * satisfied and {@link #getStatus} returns <code>INFEASIBLE</code>; a
+ * negative cycle of infinite capacity makes it <code>UNBOUNDED</code>.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class NetworkSimplexMinimumCostFlow
+{
+public:
+	enum Status { OPTIMAL, INFEASIBLE, UNBOUNDED };
+
+	Graph<V, E>* network;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * The columns by edge id respectively vertex id.
+	 */
+	vector<double> capacity;
+	vector<double> cost;
+	vector<double> supply;
+
+	/**
+	 * Flow of every edge, by edge id.
+	 */
+	vector<double> flow;
+
+	/**
+	 * Solves the problem given by maps.
+	 *
+	 * @param network the network
+	 * @param capacities capacity of the edges; missing ones are infinite
+	 * @param supplies supply (positive) or demand (negative) of the
+	 * vertices; missing ones are zero
+	 * @param costs cost of the edges per unit of flow, or <code>NULL</code>
+	 * to use the edge weights; missing ones are taken from the edge weights
+	 * as well
+	 *
+	 * @throws invalid_argument if the network is <code>NULL</code> or a
+	 * capacity is negative.
+	 */
+	NetworkSimplexMinimumCostFlow(
+		Graph<V, E>* network,
+		map<E*, double>* capacities,
+		map<V*, double>* supplies,
+		map<E*, double>* costs = NULL)
+	{
+		this->network = network;
+		csr = new CSRGraph<V, E>(network, true, false);
+		ownsSnapshot = true;
+
+		int n = csr->vertexCount;
+		int m = csr->edgeCount;
+		capacity.assign(m, numeric_limits<double>::infinity());
+		cost = csr->edgeWeights;
+		supply.assign(n, 0.0);
+
+		for (int e = 0; e < m; e++) {
+			typename map<E*, double>::iterator it;
+
+			if (capacities != NULL
+				&& (it = capacities->find(csr->edges[e])) != capacities->end())
+			{
+				capacity[e] = it->second;
+			}
+			if (costs != NULL
+				&& (it = costs->find(csr->edges[e])) != costs->end())
+			{
+				cost[e] = it->second;
+			}
+		}
+
+		if (supplies != NULL) {
+			typename map<V*, double>::iterator it;
+			for (it = supplies->begin(); it != supplies->end(); ++it) {
+				int v = csr->indexOf(it->first);
+
+				if (v >= 0) {
+					supply[v] = it->second;
+				}
+			}
+		}
+
+		solve();
+	}
+
+	/**
+	 * Solves the problem given by columns indexed by the ids of an existing
+	 * snapshot, which is neither copied nor deleted.
+	 *
+	 * @param snapshot directed snapshot of the network
+	 * @param capacities capacity of every edge
+	 * @param costs cost of every edge per unit of flow
+	 * @param supplies supply (positive) or demand (negative) of every vertex
+	 *
+	 * @throws invalid_argument if a column does not match the snapshot or a
+	 * capacity is negative.
+	 */
+	NetworkSimplexMinimumCostFlow(
+		CSRGraph<V, E>* snapshot,
+		const vector<double>& capacities,
+		const vector<double>& costs,
+		const vector<double>& supplies)
+	{
+		if ((int) capacities.size() != snapshot->edgeCount
+			|| (int) costs.size() != snapshot->edgeCount
+			|| (int) supplies.size() != snapshot->vertexCount)
+		{
+			throw new invalid_argument("Column sizes do not match the snapshot");
+		}
+
+		network = snapshot->graph;
+		csr = snapshot;
+		ownsSnapshot = false;
+		capacity = capacities;
+		cost = costs;
+		supply = supplies;
+
+		solve();
+	}
+
+	virtual ~NetworkSimplexMinimumCostFlow()
+	{
+		if (ownsSnapshot) {
+			delete csr;
+		}
+	}
+
+	/**
+	 * Returns whether an optimal flow was found.
+	 *
+	 * @return <code>OPTIMAL</code>, <code>INFEASIBLE</code> if the supplies
+	 * cannot be satisfied or <code>UNBOUNDED</code> if the cost can be
+	 * lowered without limit.
+	 */
+	Status getStatus()
+	{
+		return status;
+	}
+
+	/**
+	 * Returns the total cost of the flow.
+	 *
+	 * @return sum of flow times cost over all edges
+	 */
+	double getTotalCost()
+	{
+		double total = 0.0;
+
+		for (int e = 0; e < csr->edgeCount; e++) {
+			if (flow[e] != 0.0) {
+				total += flow[e] * cost[e];
+			}
+		}
+
+		return total;
+	}
+
+	/**
+	 * Returns the flow of the specified edge. The edge ids are looked up in
+	 * a map built on the first call.
+	 *
+	 * @param e the edge
+	 *
+	 * @return flow of the edge
+	 *
+	 * @throws invalid_argument if the edge is not found in the network.
+	 */
+	double getFlow(E* e)
+	{
+		if (edgeIndex.empty()) {
+			for (int i = 0; i < csr->edgeCount; i++) {
+				edgeIndex.insert(edgeIndex.end(), pair<E*, int>(csr->edges[i], i));
+			}
+		}
+
+		typename map<E*, int>::iterator it = edgeIndex.find(e);
+
+		if (it == edgeIndex.end()) {
+			throw new invalid_argument("No such edge in graph");
+		}
+
+		return flow[it->second];
+	}
+
+	/**
+	 * Returns the flow of the edge with the specified id of the snapshot.
+	 *
+	 * @param e edge id
+	 *
+	 * @return flow of the edge
+	 */
+	double getFlow(int e)
+	{
+		return flow[e];
+	}
+
+	/**
+	 * Returns the flow of every edge.
+	 *
+	 * @return map from the edges to their flow
+	 */
+	map<E*, double>* getFlowMap()
+	{
+		map<E*, double>* flows = new map<E*, double>();
+
+		for (int e = 0; e < csr->edgeCount; e++) {
+			(*flows)[csr->edges[e]] = flow[e];
+		}
+
+		return flows;
+	}
+
+private:
+	enum ArcState { STATE_UPPER = -1, STATE_TREE = 0, STATE_LOWER = 1 };
+
+	bool ownsSnapshot;
+	Status status;
+	map<E*, int> edgeIndex;
+
+	// arcs: the edges followed by one artificial arc per vertex
+	int arcCount;
+	vector<int> arcSource;
+	vector<int> arcTarget;
+	vector<double> arcCapacity;
+	vector<double> arcCost;
+	vector<double> arcFlow;
+	vector<int> state;
+
+	// spanning tree over the vertices and the root n; every subtree is the
+	// run of succNum[v] vertices from v to lastSucc[v] along the thread
+	int root;
+	vector<int> parent;
+	vector<int> predArc;
+	vector<int> thread;
+	vector<int> revThread;
+	vector<int> succNum;
+	vector<int> lastSucc;
+	vector<double> potential;
+
+	// the path being turned upside down by a pivot
+	vector<int> path;
+	vector<int> pathPreFirst;
+	vector<int> pathPreLast;
+	vector<int> pathPostFirst;
+	vector<int> pathPostLast;
+
+	double epsilon;
+	int nextArc;
+	int blockSize;
+
+	double reducedCost(int a)
+	{
+		return arcCost[a] + potential[arcSource[a]] - potential[arcTarget[a]];
+	}
+
+	void solve()
+	{
+		int n = csr->vertexCount;
+		int m = csr->edgeCount;
+		double maxCost = 0.0;
+		double totalSupply = 0.0;
+
+		for (int e = 0; e < m; e++) {
+			if (capacity[e] < 0.0) {
+				throw new invalid_argument("Negative capacity in network");
+			}
+			if (fabs(cost[e]) > maxCost) {
+				maxCost = fabs(cost[e]);
+			}
+		}
+		for (int v = 0; v < n; v++) {
+			totalSupply += supply[v];
+		}
+
+		flow.assign(m, 0.0);
+
+		double tolerance = 1e-9 * (1.0 + totalAbsoluteSupply());
+		if (fabs(totalSupply) > tolerance) {
+			status = INFEASIBLE;
+			return;
+		}
+
+		double bigM = (n + 1) * (maxCost + 1.0);
+		epsilon = 1e-12 * bigM;
+
+		root = n;
+		arcCount = m + n;
+		arcSource.assign(csr->edgeSources.begin(), csr->edgeSources.end());
+		arcTarget.assign(csr->edgeTargets.begin(), csr->edgeTargets.end());
+		arcCapacity = capacity;
+		arcCost = cost;
+		arcFlow.assign(arcCount, 0.0);
+		state.assign(arcCount, STATE_LOWER);
+
+		// every vertex is a leaf below the root, threaded in id order
+		parent.assign(n + 1, root);
+		predArc.assign(n + 1, -1);
+		thread.resize(n + 1);
+		revThread.resize(n + 1);
+		succNum.assign(n + 1, 1);
+		lastSucc.resize(n + 1);
+		potential.assign(n + 1, 0.0);
+
+		for (int v = 0; v <= n; v++) {
+			thread[v] = v < n ? v + 1 : 0;
+			revThread[v] = v > 0 ? v - 1 : n;
+			lastSucc[v] = v;
+		}
+		parent[root] = -1;
+		succNum[root] = n + 1;
+		lastSucc[root] = n > 0 ? n - 1 : root;
+
+		for (int v = 0; v < n; v++) {
+			int a = m + v;
+
+			if (supply[v] >= 0.0) {
+				arcSource.push_back(v);
+				arcTarget.push_back(root);
+				arcFlow[a] = supply[v];
+				potential[v] = -bigM;
+			} else {
+				arcSource.push_back(root);
+				arcTarget.push_back(v);
+				arcFlow[a] = -supply[v];
+				potential[v] = bigM;
+			}
+
+			arcCapacity.push_back(numeric_limits<double>::infinity());
+			arcCost.push_back(bigM);
+			state[a] = STATE_TREE;
+			predArc[v] = a;
+		}
+
+		blockSize = (int) sqrt((double) arcCount);
+		if (blockSize < 10) {
+			blockSize = 10;
+		}
+		nextArc = 0;
+		status = OPTIMAL;
+
+		for (int entering = findEntering(); entering >= 0; entering = findEntering()) {
+			if (!pivot(entering)) {
+				status = UNBOUNDED;
+				return;
+			}
+		}
+
+		for (int v = 0; v < n; v++) {
+			if (arcFlow[m + v] > tolerance) {
+				status = INFEASIBLE;
+			}
+		}
+
+		flow.assign(arcFlow.begin(), arcFlow.begin() + m);
+	}
+
+	double totalAbsoluteSupply()
+	{
+		double total = 0.0;
+
+		for (int v = 0; v < (int) supply.size(); v++) {
+			total += fabs(supply[v]);
+		}
+
+		return total;
+	}
+
+	/**
+	 * Block search for an arc violating its optimality condition.
+	 */
+	int findEntering()
+	{
+		double best = -epsilon;
+		int bestArc = -1;
+		int left = blockSize;
+
+		for (int i = 0; i < arcCount; i++) {
+			int a = nextArc + i < arcCount ? nextArc + i : nextArc + i - arcCount;
+			double violation = state[a] * reducedCost(a);
+
+			if (violation < best) {
+				best = violation;
+				bestArc = a;
+			}
+			if (--left == 0) {
+				if (bestArc >= 0) {
+					break;
+				}
+				left = blockSize;
+			}
+		}
+
+		if (bestArc >= 0) {
+			nextArc = bestArc + 1 < arcCount ? bestArc + 1 : 0;
+		}
+
+		return bestArc;
+	}
+
+	/**
+	 * Residual capacity of the tree arc above the vertex in the direction
+	 * towards (up) or away from (down) the root.
+	 */
+	double residualAbove(int v, bool up)
+	{
+		int a = predArc[v];
+		bool pointsUp = arcSource[a] == v;
+
+		return pointsUp == up ? arcCapacity[a] - arcFlow[a] : arcFlow[a];
+	}
+
+	void link(int u, int v)
+	{
+		thread[u] = v;
+		revThread[v] = u;
+	}
+
+	/**
+	 * Pushes flow around the cycle of the entering arc and exchanges it with
+	 * the leaving arc. Returns <code>false</code> if the cycle has infinite
+	 * capacity.
+	 */
+	bool pivot(int entering)
+	{
+		// flow runs from first to second over the entering arc
+		int first = state[entering] == STATE_LOWER ? arcSource[entering] : arcTarget[entering];
+		int second = state[entering] == STATE_LOWER ? arcTarget[entering] : arcSource[entering];
+
+		// an ancestor has a larger subtree than any of its descendants
+		int join = first;
+		int other = second;
+		while (join != other) {
+			if (succNum[join] < succNum[other]) {
+				join = parent[join];
+			} else {
+				other = parent[other];
+			}
+		}
+
+		double delta = arcCapacity[entering];
+		int leavingVertex = -1;
+		bool leavingOnFirstSide = false;
+
+		// from join down to first, then from second up to join
+		for (int u = first; u != join; u = parent[u]) {
+			double d = residualAbove(u, false);
+
+			if (d < delta) {
+				delta = d;
+				leavingVertex = u;
+				leavingOnFirstSide = true;
+			}
+		}
+		for (int u = second; u != join; u = parent[u]) {
+			double d = residualAbove(u, true);
+
+			if (d <= delta) {
+				delta = d;
+				leavingVertex = u;
+				leavingOnFirstSide = false;
+			}
+		}
+
+		if (delta == numeric_limits<double>::infinity()) {
+			return false;
+		}
+
+		if (delta > 0.0) {
+			arcFlow[entering] += state[entering] * delta;
+
+			for (int u = first; u != join; u = parent[u]) {
+				int a = predArc[u];
+				arcFlow[a] += arcSource[a] == u ? -delta : delta;
+			}
+			for (int u = second; u != join; u = parent[u]) {
+				int a = predArc[u];
+				arcFlow[a] += arcSource[a] == u ? delta : -delta;
+			}
+		}
+
+		if (leavingVertex < 0) {
+			// the entering arc reaches its other bound and stays outside
+			arcFlow[entering] = state[entering] == STATE_LOWER ? arcCapacity[entering] : 0.0;
+			state[entering] = -state[entering];
+			return true;
+		}
+
+		// the leaving arc sits exactly on a bound now, the upper one if the
+		// cycle ran along its direction
+		int leaving = predArc[leavingVertex];
+		bool pointsUp = arcSource[leaving] == leavingVertex;
+		bool atUpper = leavingOnFirstSide ? !pointsUp : pointsUp;
+		arcFlow[leaving] = atUpper ? arcCapacity[leaving] : 0.0;
+		state[leaving] = atUpper ? STATE_UPPER : STATE_LOWER;
+		state[entering] = STATE_TREE;
+
+		updateTree(
+			entering,
+			leavingOnFirstSide ? first : second,
+			leavingOnFirstSide ? second : first,
+			leavingVertex,
+			join);
+
+		return true;
+	}
+
+	/**
+	 * Cuts off the subtree below the leaving arc and hangs it below the
+	 * outer end point of the entering arc. The path from the inner end point
+	 * up to the leaving arc is turned upside down, so the inner end point
+	 * becomes the root of the subtree.
+	 */
+	void updateTree(int entering, int inner, int outer, int leavingVertex, int join)
+	{
+		path.clear();
+		for (int x = inner; x != leavingVertex; x = parent[x]) {
+			path.push_back(x);
+		}
+		path.push_back(leavingVertex);
+
+		int k = path.size() - 1;
+		int moved = succNum[leavingVertex];
+		int oldParent = parent[leavingVertex];
+		int oldLast = lastSucc[leavingVertex];
+		int oldBefore = revThread[leavingVertex];
+
+		// every path vertex above the first keeps the parts of its subtree
+		// before and after the subtree of its child on the path
+		pathPreFirst.resize(k + 1);
+		pathPreLast.resize(k + 1);
+		pathPostFirst.resize(k + 1);
+		pathPostLast.resize(k + 1);
+
+		for (int i = 1; i <= k; i++) {
+			int x = path[i];
+			int child = path[i - 1];
+
+			pathPreFirst[i] = thread[x] != child ? thread[x] : -1;
+			pathPreLast[i] = revThread[child];
+			pathPostFirst[i] = lastSucc[child] != lastSucc[x] ? thread[lastSucc[child]] : -1;
+			pathPostLast[i] = lastSucc[x];
+		}
+
+		// cut the subtree out of the thread
+		link(oldBefore, thread[oldLast]);
+
+		for (int a = oldParent; a >= 0 && lastSucc[a] == oldLast; a = parent[a]) {
+			lastSucc[a] = oldBefore;
+		}
+		for (int a = oldParent; a != join; a = parent[a]) {
+			succNum[a] -= moved;
+		}
+
+		// rethread the subtree: first the subtree of the inner end point,
+		// then every further path vertex with its remaining parts
+		int tail = lastSucc[inner];
+		int size = 0;
+
+		for (int i = k; i >= 0; i--) {
+			int own = succNum[path[i]] - (i > 0 ? succNum[path[i - 1]] : 0);
+
+			size += own;
+			succNum[path[i]] = size;
+		}
+
+		for (int i = 1; i <= k; i++) {
+			int x = path[i];
+
+			link(tail, x);
+			tail = x;
+
+			if (pathPreFirst[i] >= 0) {
+				link(tail, pathPreFirst[i]);
+				tail = pathPreLast[i];
+			}
+			if (pathPostFirst[i] >= 0) {
+				link(tail, pathPostFirst[i]);
+				tail = pathPostLast[i];
+			}
+		}
+
+		for (int i = 0; i <= k; i++) {
+			lastSucc[path[i]] = tail;
+		}
+
+		// turn the path upside down
+		int newParent = outer;
+		int newPred = entering;
+
+		for (int i = 0; i <= k; i++) {
+			int x = path[i];
+			int oldPred = predArc[x];
+
+			parent[x] = newParent;
+			predArc[x] = newPred;
+			newParent = x;
+			newPred = oldPred;
+		}
+
+		// hang the subtree in right behind the outer end point
+		int after = thread[outer];
+
+		for (int a = outer; a >= 0 && lastSucc[a] == outer; a = parent[a]) {
+			lastSucc[a] = tail;
+		}
+		for (int a = outer; a != join; a = parent[a]) {
+			succNum[a] += moved;
+		}
+
+		link(outer, inner);
+		link(tail, after);
+
+		// the whole subtree moves by the reduced cost of the entering arc
+		double shifted = arcSource[entering] == inner
+			? potential[outer] - arcCost[entering]
+			: potential[outer] + arcCost[entering];
+		double sigma = shifted - potential[inner];
+
+		for (int i = 0, v = inner; i < moved; i++, v = thread[v]) {
+			potential[v] += sigma;
+		}
+	}
+};
+
+#endif /* NETWORKSIMPLEXMINIMUMCOSTFLOW_H_ */
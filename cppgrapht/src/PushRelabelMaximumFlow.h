@@ -0,0 +1,485 @@
+#ifndef PUSHRELABELMAXIMUMFLOW_H_
+#define PUSHRELABELMAXIMUMFLOW_H_
+
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <WeightedGraph.h>
+
+/**
+ * The highest-label push-relabel algorithm (Goldberg and Tarjan, "A New
+ * Approach to the Maximum-Flow Problem", 1988) computing a maximum flow and
+ * a minimum cut of a network whose edge weights are the capacities.
+ * Directed graphs, including multigraphs with parallel edges, and undirected
+ * graphs are supported; an undirected edge may carry flow either way.
+ *
+ * <p>The residual network is stored in flat arrays grouped by tail vertex:
+ * for every edge one forward and one backward arc, each knowing the position
+ * of the other. Parallel edges simply yield parallel arcs, so no edge is
+ * stored twice and the flow of each edge is read off its own arc.</p>
+ *
+ * <p>The first phase computes a maximum preflow, always discharging an
+ * active vertex of the highest label. Two heuristics keep the labels
+ * exact:</p>
+ *
+ * <ul>
+ * <li>global relabeling: every so often the labels are reset to the exact
+ * distances to the sink by a backward breadth-first search;</li>
+ * <li>gap relabeling: once no vertex is left on some label below <code>
+ * n</code>, the vertices above cannot reach the sink any more and are lifted
+ * to <code>n</code> at once.</li>
+ * </ul>
+ *
+ * <p>The preflow already gives the flow value and the minimum cut. A second
+ * phase returns the excess stuck in front of the cut to the source, so that
+ * {@link #getMaximumFlow} is a proper flow.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class PushRelabelMaximumFlow
+{
+public:
+	/**
+	 * Work, in arc scans, between two global relabelings, per vertex.
+	 */
+	static const int GLOBAL_RELABEL_FACTOR = 6;
+
+	WeightedGraph<V, E>* network;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * The residual arcs of vertex <code>v</code> are the positions <code>
+	 * arcOffsets[v]</code> up to (excluding) <code>arcOffsets[v + 1]</code>
+	 * of <code>arcHeads</code>, <code>residual</code> and <code>mate</code>,
+	 * the position of the reverse arc.
+	 */
+	vector<int> arcOffsets;
+	vector<int> arcHeads;
+	vector<double> residual;
+	vector<int> mate;
+
+	/**
+	 * Position of the forward arc of every edge.
+	 */
+	vector<int> edgeArc;
+
+	/**
+	 * Creates the solver for the specified network.
+	 *
+	 * @param network the network
+	 *
+	 * @throws invalid_argument if the network is <code>NULL</code> or has a
+	 * negative capacity.
+	 */
+	PushRelabelMaximumFlow(WeightedGraph<V, E>* network)
+	{
+		this->network = network;
+		csr = new CSRGraph<V, E>(network);
+		source = -1;
+		sink = -1;
+		maximumFlowValue = 0.0;
+
+		if (csr->hasNegativeEdgeWeight()) {
+			delete csr;
+			throw new invalid_argument("Negative capacity in network");
+		}
+
+		int n = csr->vertexCount;
+		int m = csr->edgeCount;
+		vector<int> tails(2 * m);
+		vector<int> heads(2 * m);
+		vector<double> capacities(2 * m);
+		vector<int> ids(2 * m);
+
+		for (int e = 0; e < m; e++) {
+			tails[2 * e] = heads[2 * e + 1] = csr->edgeSources[e];
+			heads[2 * e] = tails[2 * e + 1] = csr->edgeTargets[e];
+			capacities[2 * e] = csr->edgeWeights[e];
+			capacities[2 * e + 1] = csr->directed ? 0.0 : csr->edgeWeights[e];
+			ids[2 * e] = 2 * e;
+			ids[2 * e + 1] = 2 * e + 1;
+		}
+
+		vector<int> arcIds;
+		CSRGraph<V, E>::buildRows(
+			n, tails, heads, capacities, ids,
+			arcOffsets, arcHeads, capacity, arcIds);
+
+		vector<int> position(2 * m);
+		for (int p = 0; p < 2 * m; p++) {
+			position[arcIds[p]] = p;
+		}
+
+		mate.resize(2 * m);
+		edgeArc.resize(m);
+		for (int p = 0; p < 2 * m; p++) {
+			mate[p] = position[arcIds[p] ^ 1];
+		}
+		for (int e = 0; e < m; e++) {
+			edgeArc[e] = position[2 * e];
+		}
+	}
+
+	virtual ~PushRelabelMaximumFlow()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Computes a maximum flow from the source to the sink.
+	 *
+	 * @param sourceVertex the source
+	 * @param sinkVertex the sink
+	 *
+	 * @throws invalid_argument if a vertex is not found in the network or
+	 * both are the same.
+	 */
+	void calculateMaximumFlow(V* sourceVertex, V* sinkVertex)
+	{
+		source = indexOf(sourceVertex);
+		sink = indexOf(sinkVertex);
+
+		if (source == sink) {
+			throw new invalid_argument("Source equals sink");
+		}
+
+		int n = csr->vertexCount;
+		residual = capacity;
+		excess.assign(n, 0.0);
+		height.assign(n, 0);
+		current.assign(arcOffsets.begin(), arcOffsets.end() - 1);
+
+		// saturate all arcs leaving the source
+		for (int p = arcOffsets[source]; p < arcOffsets[source + 1]; p++) {
+			push(source, p, residual[p]);
+		}
+
+		globalRelabel(sink, n);
+		discharge(sink, n, true);
+		maximumFlowValue = excess[sink];
+
+		// heights measured from the source, above all heights so far
+		globalRelabel(source, 2 * n);
+		discharge(source, 2 * n, false);
+	}
+
+	/**
+	 * Returns the value of the maximum flow.
+	 *
+	 * @return the flow value
+	 */
+	double getMaximumFlowValue()
+	{
+		return maximumFlowValue;
+	}
+
+	/**
+	 * Returns the flow of every edge. A negative flow on an undirected edge
+	 * runs from its target to its source.
+	 *
+	 * @return map from the edges to their flow
+	 *
+	 * @throws logic_error if no flow has been calculated.
+	 */
+	map<E*, double>* getMaximumFlow()
+	{
+		assertCalculated();
+
+		map<E*, double>* flow = new map<E*, double>();
+
+		for (int e = 0; e < csr->edgeCount; e++) {
+			(*flow)[csr->edges[e]] = getFlow(e);
+		}
+
+		return flow;
+	}
+
+	/**
+	 * Returns the flow of the edge with the specified id of the snapshot.
+	 *
+	 * @param e edge id
+	 *
+	 * @return flow of the edge
+	 */
+	double getFlow(int e)
+	{
+		int p = edgeArc[e];
+
+		// capacity of the pair is fixed, move the difference to the forward arc
+		return (capacity[p] - residual[p] + residual[mate[p]] - capacity[mate[p]]) / 2.0;
+	}
+
+	/**
+	 * Returns the source side of a minimum cut: the vertices still reachable
+	 * from the source in the residual network.
+	 *
+	 * @return the vertices on the source side
+	 *
+	 * @throws logic_error if no flow has been calculated.
+	 */
+	set<V*>* getSourcePartition()
+	{
+		assertCalculated();
+
+		vector<char> reached;
+		sourceSide(reached);
+
+		set<V*>* partition = new set<V*>();
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			if (reached[v]) {
+				partition->insert(csr->vertices[v]);
+			}
+		}
+
+		return partition;
+	}
+
+	/**
+	 * Returns the edges of a minimum cut: the edges leading from the source
+	 * side to the sink side. Their capacities add up to the flow value.
+	 *
+	 * @return the cut edges
+	 *
+	 * @throws logic_error if no flow has been calculated.
+	 */
+	set<E*>* getCutEdges()
+	{
+		assertCalculated();
+
+		vector<char> reached;
+		sourceSide(reached);
+
+		set<E*>* cut = new set<E*>();
+
+		for (int e = 0; e < csr->edgeCount; e++) {
+			int u = csr->edgeSources[e];
+			int v = csr->edgeTargets[e];
+
+			if (reached[u] != reached[v] && (reached[u] || !csr->directed)) {
+				cut->insert(csr->edges[e]);
+			}
+		}
+
+		return cut;
+	}
+
+private:
+	int source;
+	int sink;
+	double maximumFlowValue;
+
+	vector<double> capacity;
+	vector<double> excess;
+	vector<int> height;
+	vector<int> current;
+
+	/**
+	 * Active vertices by height, with stale entries skipped when popped.
+	 */
+	vector<vector<int> > buckets;
+	int highest;
+
+	/**
+	 * Number of vertices on every height below n.
+	 */
+	vector<int> count;
+
+	int indexOf(V* v)
+	{
+		int id = csr->indexOf(v);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return id;
+	}
+
+	void assertCalculated()
+	{
+		if (source < 0) {
+			throw new logic_error("Maximum flow not calculated");
+		}
+	}
+
+	void push(int v, int p, double delta)
+	{
+		int w = arcHeads[p];
+
+		residual[p] -= delta;
+		residual[mate[p]] += delta;
+		excess[v] -= delta;
+		excess[w] += delta;
+	}
+
+	void activate(int w)
+	{
+		if (w != source && w != sink && height[w] < (int) buckets.size()) {
+			buckets[height[w]].push_back(w);
+
+			if (height[w] > highest) {
+				highest = height[w];
+			}
+		}
+	}
+
+	/**
+	 * Sets every height to the residual distance to the target plus the
+	 * base, or to the limit where the target cannot be reached, and refills
+	 * the buckets.
+	 */
+	void globalRelabel(int target, int limit)
+	{
+		int n = csr->vertexCount;
+		int base = limit - n;
+		vector<int> queue(1, target);
+
+		height.assign(n, limit);
+		height[target] = base;
+
+		for (int head = 0; head < (int) queue.size(); head++) {
+			int u = queue[head];
+
+			for (int p = arcOffsets[u]; p < arcOffsets[u + 1]; p++) {
+				int w = arcHeads[p];
+
+				if (height[w] == limit && w != source && residual[mate[p]] > 0.0) {
+					height[w] = height[u] + 1;
+					queue.push_back(w);
+				}
+			}
+		}
+
+		if (target == sink) {
+			height[source] = n;
+		}
+
+		buckets.assign(limit, vector<int>());
+		count.assign(limit, 0);
+		highest = -1;
+
+		for (int v = 0; v < n; v++) {
+			current[v] = arcOffsets[v];
+
+			if (height[v] < limit) {
+				count[height[v]]++;
+			}
+			if (excess[v] > 0.0) {
+				activate(v);
+			}
+		}
+	}
+
+	/**
+	 * Discharges the active vertices below the limit, highest first.
+	 */
+	void discharge(int target, int limit, bool heuristics)
+	{
+		int n = csr->vertexCount;
+		long work = 0;
+		long workLimit = (long) GLOBAL_RELABEL_FACTOR * n + arcHeads.size();
+
+		while (highest >= 0) {
+			if (buckets[highest].empty()) {
+				highest--;
+				continue;
+			}
+
+			int v = buckets[highest].back();
+			buckets[highest].pop_back();
+
+			if (height[v] != highest || excess[v] <= 0.0) {
+				continue; // stale entry
+			}
+
+			while (excess[v] > 0.0 && height[v] < limit) {
+				if (current[v] == arcOffsets[v + 1]) {
+					work += relabel(v, limit, heuristics);
+					continue;
+				}
+
+				int p = current[v];
+				int w = arcHeads[p];
+
+				if (residual[p] > 0.0 && height[v] == height[w] + 1) {
+					bool wasIdle = excess[w] <= 0.0;
+					push(v, p, excess[v] < residual[p] ? excess[v] : residual[p]);
+
+					if (wasIdle) {
+						activate(w);
+					}
+				} else {
+					current[v]++;
+				}
+			}
+
+			if (heuristics && work > workLimit) {
+				globalRelabel(target, limit);
+				work = 0;
+			}
+		}
+	}
+
+	/**
+	 * Lifts the vertex just above its lowest residual neighbor and applies
+	 * the gap heuristic. Returns the work done.
+	 */
+	int relabel(int v, int limit, bool heuristics)
+	{
+		int old = height[v];
+		int lowest = limit - 1;
+
+		for (int p = arcOffsets[v]; p < arcOffsets[v + 1]; p++) {
+			if (residual[p] > 0.0 && height[arcHeads[p]] < lowest) {
+				lowest = height[arcHeads[p]];
+			}
+		}
+
+		height[v] = lowest + 1;
+		current[v] = arcOffsets[v];
+		count[old]--;
+
+		if (height[v] < limit) {
+			count[height[v]]++;
+		}
+
+		if (heuristics && count[old] == 0) {
+			// nothing left on this height, all above are cut off from the sink
+			for (int u = 0; u < csr->vertexCount; u++) {
+				if (height[u] > old && height[u] < limit) {
+					count[height[u]]--;
+					height[u] = limit;
+				}
+			}
+		}
+
+		return 12 + arcOffsets[v + 1] - arcOffsets[v];
+	}
+
+	/**
+	 * Marks the vertices reachable from the source in the residual network.
+	 */
+	void sourceSide(vector<char>& reached)
+	{
+		reached.assign(csr->vertexCount, 0);
+		vector<int> queue(1, source);
+		reached[source] = 1;
+
+		for (int head = 0; head < (int) queue.size(); head++) {
+			int u = queue[head];
+
+			for (int p = arcOffsets[u]; p < arcOffsets[u + 1]; p++) {
+				if (residual[p] > 0.0 && !reached[arcHeads[p]]) {
+					reached[arcHeads[p]] = 1;
+					queue.push_back(arcHeads[p]);
+				}
+			}
+		}
+	}
+};
+
+#endif /* PUSHRELABELMAXIMUMFLOW_H_ */
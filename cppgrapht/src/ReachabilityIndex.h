@@ -0,0 +1,386 @@
+#ifndef REACHABILITYINDEX_H_
+#define REACHABILITYINDEX_H_
+
+#include <climits>
+#include <map>
+#include <stdexcept>
+#include <vector>
+#include <Graph.h>
+#include <StrongConnectivityInspector.h>
+
+/**
+ * Answers whether a vertex can reach another one, with interval labels on the
+ * condensation of the graph (Yildirim, Chaoji and Zaki, "GRAIL: Scalable
+ * Reachability Index for Large Graphs", VLDB 2010). For an undirected graph a
+ * vertex reaches exactly the vertices of its connected component.
+ *
+ * <p>The strongly connected components are contracted first; their ids are
+ * topologically sorted, so a component can only reach components of higher
+ * id. Each of <code>labelCount</code> depth-first traversals of the
+ * condensation, visiting the roots and the successors of every component in
+ * a different random rotation, numbers the components in post-order and
+ * labels each one with the interval from the smallest post-order number it
+ * reaches to its own. If <code>c</code> reaches <code>d</code>, the interval
+ * of <code>d</code> lies within that of <code>c</code> in every traversal, so
+ * a single interval not contained in the other proves that there is no path.
+ * The post-order range of the subtree of <code>c</code> in the spanning
+ * forest of the first traversal in turn proves that there is one. The
+ * traversals run in parallel when compiled with OpenMP.</p>
+ *
+ * <p>A query comparing the component ids, the intervals and the subtree range
+ * is answered in constant time; only the remaining, rare queries fall back to
+ * a depth-first search of the condensation which skips every component whose
+ * labels already exclude the target. The search uses scratch space of the
+ * index, so an instance must not be queried from several threads at
+ * once.</p>
+ *
+ * <p>Only the vertex ids, the component of every vertex, the condensation and
+ * the labels are kept, about <code>2 labelCount + 2</code> integers per
+ * component besides the condensation. The index is a snapshot; it is not
+ * updated when the graph changes.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class ReachabilityIndex
+{
+public:
+	static const int DEFAULT_LABEL_COUNT = 4;
+
+	map<V*, int> vertexIndex;
+
+	/**
+	 * Component id of every vertex, in topological order of the
+	 * condensation.
+	 */
+	vector<int> component;
+
+	/**
+	 * The condensation as CSR arrays, see {@link
+	 * StrongConnectivityInspector#condensationOffsets}.
+	 */
+	vector<int> condensationOffsets;
+	vector<int> condensationTargets;
+
+	int componentCount;
+	int labelCount;
+
+	/**
+	 * Interval of every component in every traversal, <code>[low[c *
+	 * labelCount + i], post[c * labelCount + i]]</code> for traversal
+	 * <code>i</code>.
+	 */
+	vector<int> low;
+	vector<int> post;
+
+	/**
+	 * First post-order number of the subtree of every component in the
+	 * spanning forest of the first traversal.
+	 */
+	vector<int> treeStart;
+
+	/**
+	 * Number of queries answered by the labels and by a search,
+	 * respectively.
+	 */
+	long labelAnswerCount;
+	long searchCount;
+
+	/**
+	 * Builds the index of the specified graph.
+	 *
+	 * @param g the graph to be indexed
+	 * @param labelCount number of intervals per component
+	 * @param parallel whether to use the parallel variant of {@link
+	 * StrongConnectivityInspector}
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code> or the
+	 * number of intervals is not positive.
+	 */
+	ReachabilityIndex(
+		Graph<V, E>* g,
+		int labelCount = DEFAULT_LABEL_COUNT,
+		bool parallel = false)
+	{
+		if (labelCount <= 0) {
+			throw new invalid_argument("Number of labels must be positive");
+		}
+
+		StrongConnectivityInspector<V, E> inspector(g, parallel);
+
+		vertexIndex.swap(inspector.csr->vertexIndex);
+		component.swap(inspector.component);
+		condensationOffsets.swap(inspector.condensationOffsets);
+		condensationTargets.swap(inspector.condensationTargets);
+		componentCount = inspector.getComponentCount();
+		this->labelCount = labelCount;
+
+		buildLabels();
+
+		mark.assign(componentCount, 0);
+		stamp = 0;
+		labelAnswerCount = 0;
+		searchCount = 0;
+	}
+
+	virtual ~ReachabilityIndex()
+	{
+	}
+
+	/**
+	 * Returns whether there is a path from the source vertex to the target
+	 * vertex. Every vertex reaches itself.
+	 *
+	 * @param sourceVertex the source vertex
+	 * @param targetVertex the target vertex
+	 *
+	 * @return <code>true</code> if the target is reachable from the source.
+	 *
+	 * @throws invalid_argument if a vertex is not found in the graph.
+	 */
+	bool canReach(V* sourceVertex, V* targetVertex)
+	{
+		return canReachComponent(component[indexOf(sourceVertex)], component[indexOf(targetVertex)]);
+	}
+
+	/**
+	 * Returns whether a component reaches another one in the condensation.
+	 *
+	 * @param c the source component
+	 * @param d the target component
+	 *
+	 * @return <code>true</code> if <code>d</code> is reachable from
+	 * <code>c</code>.
+	 */
+	bool canReachComponent(int c, int d)
+	{
+		if (c == d || covers(c, d)) {
+			labelAnswerCount++;
+
+			return true;
+		}
+		if (c > d || !contains(c, d)) {
+			labelAnswerCount++;
+
+			return false;
+		}
+
+		searchCount++;
+
+		return search(c, d);
+	}
+
+	/**
+	 * Returns the number of strongly connected components.
+	 *
+	 * @return the number of components
+	 */
+	int getComponentCount()
+	{
+		return componentCount;
+	}
+
+private:
+	vector<int> mark;
+	int stamp;
+
+	int indexOf(V* vertex)
+	{
+		typename map<V*, int>::iterator it = vertexIndex.find(vertex);
+
+		if (it == vertexIndex.end()) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return it->second;
+	}
+
+	/**
+	 * Returns whether every interval of <code>d</code> lies within the one of
+	 * <code>c</code>, as it does if <code>c</code> reaches <code>d</code>.
+	 */
+	bool contains(int c, int d)
+	{
+		const int* lowC = &low[c * labelCount];
+		const int* lowD = &low[d * labelCount];
+		const int* postC = &post[c * labelCount];
+		const int* postD = &post[d * labelCount];
+
+		for (int i = 0; i < labelCount; i++) {
+			if (lowD[i] < lowC[i] || postD[i] > postC[i]) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Returns whether <code>d</code> lies in the subtree of <code>c</code> in
+	 * the spanning forest of the first traversal.
+	 */
+	bool covers(int c, int d)
+	{
+		int p = post[d * labelCount];
+
+		return treeStart[c] <= p && p <= post[c * labelCount];
+	}
+
+	/**
+	 * Searches the condensation depth first from <code>c</code> for <code>
+	 * d</code>, skipping the components which cannot reach it by their id or
+	 * labels.
+	 */
+	bool search(int c, int d)
+	{
+		if (++stamp == INT_MAX) {
+			mark.assign(componentCount, 0);
+			stamp = 1;
+		}
+
+		vector<int> stack(1, c);
+		mark[c] = stamp;
+
+		while (!stack.empty()) {
+			int x = stack.back();
+			stack.pop_back();
+
+			for (int a = condensationOffsets[x]; a < condensationOffsets[x + 1]; a++) {
+				int y = condensationTargets[a];
+
+				if (y == d || (y < d && covers(y, d))) {
+					return true;
+				}
+				if (y < d && mark[y] != stamp && contains(y, d)) {
+					mark[y] = stamp;
+					stack.push_back(y);
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void buildLabels()
+	{
+		int count = componentCount;
+		vector<int> roots;
+		vector<char> hasPredecessor(count, 0);
+
+		for (int a = 0; a < (int) condensationTargets.size(); a++) {
+			hasPredecessor[condensationTargets[a]] = 1;
+		}
+		for (int c = 0; c < count; c++) {
+			if (!hasPredecessor[c]) {
+				roots.push_back(c);
+			}
+		}
+
+		low.resize((long) count * labelCount);
+		post.resize((long) count * labelCount);
+		treeStart.resize(count);
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (int i = 0; i < labelCount; i++) {
+			traverse(i, roots);
+		}
+	}
+
+	/**
+	 * The state of one traversal.
+	 */
+	struct Traversal
+	{
+		int index;
+		unsigned int random;
+		int counter;
+		vector<char> visited;
+		vector<int> rotation;
+		vector<int> nextArc;
+		vector<int> stack;
+
+		Traversal(int index, int count)
+		{
+			this->index = index;
+			random = 2654435761u * (unsigned int) (index + 1);
+			counter = 0;
+			visited.assign(count, 0);
+			rotation.assign(count, 0);
+			nextArc.assign(count, 0);
+		}
+
+		int nextRandom(int bound)
+		{
+			random = random * 1103515245u + 12345u;
+
+			return (int) ((random >> 8) % (unsigned int) bound);
+		}
+	};
+
+	/**
+	 * Labels the components by the specified traversal, which visits the
+	 * roots and the successors of every component starting at a random
+	 * rotation.
+	 */
+	void traverse(int index, const vector<int>& roots)
+	{
+		Traversal t(index, componentCount);
+		int rootCount = roots.size();
+		int rootShift = rootCount > 0 ? t.nextRandom(rootCount) : 0;
+
+		for (int r = 0; r < rootCount; r++) {
+			enter(t, roots[(r + rootShift) % rootCount]);
+
+			while (!t.stack.empty()) {
+				int c = t.stack.back();
+				int slot = c * labelCount + index;
+				int begin = condensationOffsets[c];
+				int degree = condensationOffsets[c + 1] - begin;
+
+				if (t.nextArc[c] < degree) {
+					int d = condensationTargets[begin + (t.rotation[c] + t.nextArc[c]++) % degree];
+
+					if (!t.visited[d]) {
+						enter(t, d);
+					} else if (low[d * labelCount + index] < low[slot]) {
+						low[slot] = low[d * labelCount + index];
+					}
+
+					continue;
+				}
+
+				// all successors are done: number the component and pass its
+				// low end to the parent
+				t.stack.pop_back();
+				post[slot] = t.counter++;
+
+				if (post[slot] < low[slot]) {
+					low[slot] = post[slot];
+				}
+				if (!t.stack.empty()) {
+					int parent = t.stack.back() * labelCount + index;
+
+					if (low[slot] < low[parent]) {
+						low[parent] = low[slot];
+					}
+				}
+			}
+		}
+	}
+
+	void enter(Traversal& t, int c)
+	{
+		int degree = condensationOffsets[c + 1] - condensationOffsets[c];
+
+		t.visited[c] = 1;
+		t.rotation[c] = degree > 0 ? t.nextRandom(degree) : 0;
+		t.stack.push_back(c);
+		low[c * labelCount + t.index] = INT_MAX;
+
+		if (t.index == 0) {
+			treeStart[c] = t.counter;
+		}
+	}
+};
+
+#endif /* REACHABILITYINDEX_H_ */
@@ -0,0 +1,636 @@
+#ifndef STRONGCONNECTIVITYINSPECTOR_H_
+#define STRONGCONNECTIVITYINSPECTOR_H_
+
+#include <list>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <ClassBasedEdgeFactory.h>
+#include <CSRGraph.h>
+#include <DefaultDirectedGraph.h>
+#include <DefaultEdge.h>
+#include <Graph.h>
+
+/**
+ * Computes the strongly connected components of a directed graph and its
+ * condensation, the directed acyclic graph with one vertex per component.
+ * For an undirected graph the strongly connected components are its
+ * connected components.
+ *
+ * <p>Two strategies are available:</p>
+ *
+ * <ul>
+ * <li>Tarjan's algorithm, with an explicit stack of the vertices being
+ * visited instead of recursion, so deep graphs cannot overflow the call
+ * stack;</li>
+ * <li>a parallel variant for huge graphs following the Multistep method
+ * (Slota, Rajamanickam and Madduri, "BFS and Coloring-based Parallel
+ * Algorithms for Strongly Connected Components and Related Problems", 2014):
+ * trimming of vertices without incoming or outgoing edges, a forward-backward
+ * search from a pivot of high degree which usually finds the giant
+ * component, and rounds of coloring for the rest. Once coloring makes little
+ * progress the remaining vertices are left to Tarjan's algorithm. The loops
+ * run in parallel when compiled with OpenMP.</li>
+ * </ul>
+ *
+ * <p>Either way the components are numbered in topological order of the
+ * condensation: every edge between two components leads from the lower to
+ * the higher id.</p>
+ *
+ * <p>The result is a snapshot; it is not updated when the graph changes.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class StrongConnectivityInspector
+{
+public:
+	static const int TRIM_ROUNDS = 3;
+
+	/**
+	 * Number of remaining vertices below which the parallel variant hands
+	 * over to Tarjan's algorithm.
+	 */
+	static const int SERIAL_CUTOFF = 65536;
+
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * Component id of every vertex, indexed by the vertex ids of the
+	 * snapshot.
+	 */
+	vector<int> component;
+
+	/**
+	 * Number of vertices of every component.
+	 */
+	vector<int> componentSizes;
+
+	/**
+	 * The condensation as CSR arrays: the successors of component <code>
+	 * c</code> are <code>condensationTargets[condensationOffsets[c]]</code>
+	 * up to (excluding) <code>condensationTargets[condensationOffsets[c +
+	 * 1]]</code>, each listed once.
+	 */
+	vector<int> condensationOffsets;
+	vector<int> condensationTargets;
+
+	/**
+	 * Computes the strongly connected components of the specified graph.
+	 *
+	 * @param g the graph to inspect
+	 * @param parallel whether to use the parallel variant instead of Tarjan's
+	 * algorithm
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	StrongConnectivityInspector(Graph<V, E>* g, bool parallel = false)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, parallel);
+
+		int n = csr->vertexCount;
+		vector<char> active(n, 1);
+		component.assign(n, -1);
+		componentCount = 0;
+
+		if (parallel) {
+			runParallel(active);
+		} else {
+			runTarjan(active);
+		}
+
+		sortTopologically();
+	}
+
+	virtual ~StrongConnectivityInspector()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Returns the number of strongly connected components.
+	 *
+	 * @return the number of components
+	 */
+	int getComponentCount()
+	{
+		return componentCount;
+	}
+
+	/**
+	 * Returns whether the graph is strongly connected. The empty graph is not
+	 * strongly connected.
+	 *
+	 * @return <code>true</code> if there is exactly one component.
+	 */
+	bool isStronglyConnected()
+	{
+		return componentCount == 1;
+	}
+
+	/**
+	 * Returns the id of the component containing the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return the component id
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	int getComponentOf(V* vertex)
+	{
+		int id = csr->indexOf(vertex);
+
+		if (id < 0) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return component[id];
+	}
+
+	/**
+	 * Returns the vertices of the component containing the specified vertex.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return set of the vertices strongly connected to the vertex
+	 *
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	set<V*>* stronglyConnectedSetOf(V* vertex)
+	{
+		int c = getComponentOf(vertex);
+		set<V*>* connectedSet = new set<V*>();
+
+		for (int v = 0; v < csr->vertexCount; v++) {
+			if (component[v] == c) {
+				connectedSet->insert(csr->vertices[v]);
+			}
+		}
+
+		return connectedSet;
+	}
+
+	/**
+	 * Returns the vertex sets of all components, in topological order.
+	 *
+	 * @return list of the strongly connected sets
+	 */
+	list<set<V*>*>* stronglyConnectedSets()
+	{
+		vector<set<V*>*> sets(componentCount);
+
+		for (int c = 0; c < componentCount; c++) {
+			sets[c] = new set<V*>();
+		}
+		for (int v = 0; v < csr->vertexCount; v++) {
+			sets[component[v]]->insert(csr->vertices[v]);
+		}
+
+		return new list<set<V*>*>(sets.begin(), sets.end());
+	}
+
+	/**
+	 * Builds the condensation as a new graph. Its vertices are the sets
+	 * returned by {@link #stronglyConnectedSets}, and there is an edge
+	 * between two of them if the graph has an edge between their members.
+	 * The caller owns the graph, its vertices and its edges.
+	 *
+	 * @return the condensation
+	 */
+	DefaultDirectedGraph<set<V*>, DefaultEdge<set<V*> > >* getCondensation()
+	{
+		DefaultDirectedGraph<set<V*>, DefaultEdge<set<V*> > >* condensation =
+			new DefaultDirectedGraph<set<V*>, DefaultEdge<set<V*> > >(
+				new ClassBasedEdgeFactory<set<V*>, DefaultEdge<set<V*> > >());
+
+		list<set<V*>*>* sets = stronglyConnectedSets();
+		vector<set<V*>*> nodes(sets->begin(), sets->end());
+		delete sets;
+
+		for (int c = 0; c < componentCount; c++) {
+			condensation->addVertex(nodes[c]);
+		}
+		for (int c = 0; c < componentCount; c++) {
+			for (int a = condensationOffsets[c]; a < condensationOffsets[c + 1]; a++) {
+				condensation->addEdge(nodes[c], nodes[condensationTargets[a]]);
+			}
+		}
+
+		return condensation;
+	}
+
+private:
+	int componentCount;
+
+	/**
+	 * Runs Tarjan's algorithm on the active vertices. Every component found
+	 * is labeled and deactivated.
+	 */
+	void runTarjan(vector<char>& active)
+	{
+		int n = csr->vertexCount;
+		vector<int> index(n, -1);
+		vector<int> low(n, 0);
+		vector<int> nextArc(n, 0);
+		vector<char> onStack(n, 0);
+		vector<int> stack;
+		vector<int> visiting;
+		int counter = 0;
+
+		for (int s = 0; s < n; s++) {
+			if (!active[s] || index[s] >= 0) {
+				continue;
+			}
+
+			index[s] = low[s] = counter++;
+			nextArc[s] = csr->outOffsets[s];
+			stack.push_back(s);
+			onStack[s] = 1;
+			visiting.push_back(s);
+
+			while (!visiting.empty()) {
+				int v = visiting.back();
+
+				if (nextArc[v] < csr->outOffsets[v + 1]) {
+					int w = csr->outTargets[nextArc[v]++];
+
+					if (!active[w]) {
+						continue;
+					}
+					if (index[w] < 0) {
+						index[w] = low[w] = counter++;
+						nextArc[w] = csr->outOffsets[w];
+						stack.push_back(w);
+						onStack[w] = 1;
+						visiting.push_back(w);
+					} else if (onStack[w] && index[w] < low[v]) {
+						low[v] = index[w];
+					}
+
+					continue;
+				}
+
+				// all arcs of v are done, return to its parent
+				visiting.pop_back();
+
+				if (!visiting.empty() && low[v] < low[visiting.back()]) {
+					low[visiting.back()] = low[v];
+				}
+
+				if (low[v] == index[v]) {
+					int id = componentCount++;
+					int w;
+
+					do {
+						w = stack.back();
+						stack.pop_back();
+						onStack[w] = 0;
+						active[w] = 0;
+						component[w] = id;
+					} while (w != v);
+				}
+			}
+		}
+	}
+
+	/**
+	 * The parallel variant: trimming, one forward-backward search, coloring
+	 * and finally Tarjan's algorithm for what is left.
+	 */
+	void runParallel(vector<char>& active)
+	{
+		int remaining = csr->vertexCount;
+
+		remaining -= trim(active);
+
+		if (remaining > 0) {
+			remaining -= forwardBackward(active);
+		}
+
+		while (remaining > SERIAL_CUTOFF) {
+			int removed = color(active);
+			remaining -= removed;
+
+			if (removed < remaining / 64) {
+				break;
+			}
+		}
+
+		if (remaining > 0) {
+			runTarjan(active);
+		}
+	}
+
+	/**
+	 * Removes the vertices without active predecessors or successors, each
+	 * of which is a component by itself.
+	 */
+	int trim(vector<char>& active)
+	{
+		int n = csr->vertexCount;
+		int trimmed = 0;
+
+		for (int round = 0; round < TRIM_ROUNDS; round++) {
+			int count = 0;
+
+			#pragma omp parallel for schedule(dynamic, 4096) reduction(+:count)
+			for (int v = 0; v < n; v++) {
+				if (!active[v]) {
+					continue;
+				}
+
+				bool hasIn = false;
+				bool hasOut = false;
+
+				for (int a = csr->inOffsets[v]; a < csr->inOffsets[v + 1] && !hasIn; a++) {
+					hasIn = csr->inSources[a] != v && active[csr->inSources[a]];
+				}
+				for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1] && !hasOut; a++) {
+					hasOut = csr->outTargets[a] != v && active[csr->outTargets[a]];
+				}
+
+				// a neighbor trimmed concurrently was a component by itself,
+				// so seeing it either way is correct
+				if (!hasIn || !hasOut) {
+					component[v] = __sync_fetch_and_add(&componentCount, 1);
+					active[v] = 0;
+					count++;
+				}
+			}
+
+			trimmed += count;
+
+			if (count == 0) {
+				break;
+			}
+		}
+
+		return trimmed;
+	}
+
+	/**
+	 * Finds the component of the active vertex with the largest product of
+	 * in and out degree as the intersection of its forward and backward
+	 * reachable sets.
+	 */
+	int forwardBackward(vector<char>& active)
+	{
+		int n = csr->vertexCount;
+		int pivot = -1;
+		long best = -1;
+
+		for (int v = 0; v < n; v++) {
+			long degree = (long) csr->inDegreeOf(v) * csr->outDegreeOf(v);
+
+			if (active[v] && degree > best) {
+				best = degree;
+				pivot = v;
+			}
+		}
+
+		vector<int> forward(n, 0);
+		vector<int> backward(n, 0);
+		reach(pivot, false, active, forward);
+		reach(pivot, true, active, backward);
+
+		int id = componentCount++;
+		int count = 0;
+
+		#pragma omp parallel for schedule(static) reduction(+:count)
+		for (int v = 0; v < n; v++) {
+			if (forward[v] && backward[v]) {
+				component[v] = id;
+				active[v] = 0;
+				count++;
+			}
+		}
+
+		return count;
+	}
+
+	/**
+	 * Marks the active vertices reachable from the start vertex by a level
+	 * synchronous breadth-first search, expanding each level in parallel.
+	 */
+	void reach(int start, bool backward, vector<char>& active, vector<int>& mark)
+	{
+		const int* offsets = backward ? csr->inOffsets.data() : csr->outOffsets.data();
+		const int* heads = backward ? csr->inSources.data() : csr->outTargets.data();
+		vector<int> frontier(1, start);
+		mark[start] = 1;
+
+		while (!frontier.empty()) {
+			vector<int> next;
+
+			#pragma omp parallel
+			{
+				vector<int> local;
+
+				#pragma omp for schedule(dynamic, 256) nowait
+				for (int i = 0; i < (int) frontier.size(); i++) {
+					int v = frontier[i];
+
+					for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+						int w = heads[a];
+
+						if (active[w] && mark[w] == 0
+							&& __sync_bool_compare_and_swap(&mark[w], 0, 1))
+						{
+							local.push_back(w);
+						}
+					}
+				}
+
+				#pragma omp critical
+				next.insert(next.end(), local.begin(), local.end());
+			}
+
+			frontier.swap(next);
+		}
+	}
+
+	/**
+	 * One round of coloring: the largest vertex id is propagated along the
+	 * edges until nothing changes, so every vertex carries the largest id
+	 * that reaches it. A vertex keeping its own id is the root of its color;
+	 * its component consists of the vertices of its color from which it can
+	 * be reached. The backward searches of different roots are disjoint and
+	 * run in parallel.
+	 */
+	int color(vector<char>& active)
+	{
+		int n = csr->vertexCount;
+		vector<int> colors(n);
+
+		#pragma omp parallel for schedule(static)
+		for (int v = 0; v < n; v++) {
+			colors[v] = v;
+		}
+
+		for (int changed = 1; changed > 0;) {
+			changed = 0;
+
+			#pragma omp parallel for schedule(dynamic, 4096) reduction(+:changed)
+			for (int v = 0; v < n; v++) {
+				if (!active[v]) {
+					continue;
+				}
+
+				int best = colors[v];
+
+				for (int a = csr->inOffsets[v]; a < csr->inOffsets[v + 1]; a++) {
+					int u = csr->inSources[a];
+
+					if (active[u] && colors[u] > best) {
+						best = colors[u];
+					}
+				}
+
+				if (best > colors[v]) {
+					colors[v] = best;
+					changed++;
+				}
+			}
+		}
+
+		vector<int> roots;
+
+		for (int v = 0; v < n; v++) {
+			if (active[v] && colors[v] == v) {
+				roots.push_back(v);
+			}
+		}
+
+		int removed = 0;
+
+		#pragma omp parallel for schedule(dynamic, 1) reduction(+:removed)
+		for (int i = 0; i < (int) roots.size(); i++) {
+			int root = roots[i];
+			int id = __sync_fetch_and_add(&componentCount, 1);
+			vector<int> queue(1, root);
+			component[root] = id;
+
+			for (int head = 0; head < (int) queue.size(); head++) {
+				int v = queue[head];
+
+				for (int a = csr->inOffsets[v]; a < csr->inOffsets[v + 1]; a++) {
+					int u = csr->inSources[a];
+
+					if (active[u] && colors[u] == root && component[u] < 0) {
+						component[u] = id;
+						queue.push_back(u);
+					}
+				}
+			}
+
+			removed += queue.size();
+		}
+
+		#pragma omp parallel for schedule(static)
+		for (int v = 0; v < n; v++) {
+			if (active[v] && component[v] >= 0) {
+				active[v] = 0;
+			}
+		}
+
+		return removed;
+	}
+
+	/**
+	 * Renumbers the components in topological order of the condensation
+	 * (Kahn's algorithm) and builds the condensation and component sizes
+	 * for the final ids.
+	 */
+	void sortTopologically()
+	{
+		buildCondensation();
+
+		vector<int> inDegree(componentCount, 0);
+		vector<int> order;
+
+		for (int a = 0; a < (int) condensationTargets.size(); a++) {
+			inDegree[condensationTargets[a]]++;
+		}
+		for (int c = 0; c < componentCount; c++) {
+			if (inDegree[c] == 0) {
+				order.push_back(c);
+			}
+		}
+		for (int head = 0; head < (int) order.size(); head++) {
+			int c = order[head];
+
+			for (int a = condensationOffsets[c]; a < condensationOffsets[c + 1]; a++) {
+				if (--inDegree[condensationTargets[a]] == 0) {
+					order.push_back(condensationTargets[a]);
+				}
+			}
+		}
+
+		vector<int> rank(componentCount);
+
+		for (int i = 0; i < componentCount; i++) {
+			rank[order[i]] = i;
+		}
+		for (int v = 0; v < csr->vertexCount; v++) {
+			component[v] = rank[component[v]];
+		}
+
+		buildCondensation();
+	}
+
+	/**
+	 * Collects the distinct arcs between components and the component sizes
+	 * from the current labels.
+	 */
+	void buildCondensation()
+	{
+		int n = csr->vertexCount;
+
+		// group the vertices by component with a counting sort
+		vector<int> memberOffsets(componentCount + 1, 0);
+		vector<int> members(n);
+
+		for (int v = 0; v < n; v++) {
+			memberOffsets[component[v] + 1]++;
+		}
+		for (int c = 0; c < componentCount; c++) {
+			memberOffsets[c + 1] += memberOffsets[c];
+		}
+
+		vector<int> next(memberOffsets.begin(), memberOffsets.end() - 1);
+
+		for (int v = 0; v < n; v++) {
+			members[next[component[v]]++] = v;
+		}
+
+		componentSizes.resize(componentCount);
+		condensationOffsets.assign(componentCount + 1, 0);
+		condensationTargets.clear();
+
+		vector<int> seen(componentCount, -1);
+
+		for (int c = 0; c < componentCount; c++) {
+			componentSizes[c] = memberOffsets[c + 1] - memberOffsets[c];
+
+			for (int i = memberOffsets[c]; i < memberOffsets[c + 1]; i++) {
+				int v = members[i];
+
+				for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+					int d = component[csr->outTargets[a]];
+
+					if (d != c && seen[d] != c) {
+						seen[d] = c;
+						condensationTargets.push_back(d);
+					}
+				}
+			}
+
+			condensationOffsets[c + 1] = condensationTargets.size();
+		}
+	}
+};
+
+#endif /* STRONGCONNECTIVITYINSPECTOR_H_ */
@@ -0,0 +1,111 @@
+#ifndef TOPOLOGICALSORT_H_
+#define TOPOLOGICALSORT_H_
+
+#include <list>
+#include <vector>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+/**
+ * Kahn's algorithm computing a topological order of a directed graph: a
+ * vertex is emitted as soon as all its predecessors have been, tracked by a
+ * flat array of remaining in degrees over a {@link CSRGraph} snapshot. The
+ * order is deterministic; among the vertices ready at the same time the one
+ * first in the vertex set comes first.
+ *
+ * <p>If the graph contains a cycle the vertices on it and behind it are
+ * never emitted, so {@link #isAcyclic} returns <code>false</code>.</p>
+ *
+ * @see DirectedAcyclicGraph
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class TopologicalSort
+{
+public:
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+
+	/**
+	 * The vertex ids of the snapshot in topological order; shorter than the
+	 * number of vertices if the graph is cyclic.
+	 */
+	vector<int> order;
+
+	/**
+	 * Sorts the specified graph.
+	 *
+	 * @param g the graph to sort
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	TopologicalSort(Graph<V, E>* g)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g);
+
+		int n = csr->vertexCount;
+		vector<int> inDegree(n, 0);
+
+		for (int a = 0; a < (int) csr->outTargets.size(); a++) {
+			inDegree[csr->outTargets[a]]++;
+		}
+
+		order.reserve(n);
+
+		for (int v = 0; v < n; v++) {
+			if (inDegree[v] == 0) {
+				order.push_back(v);
+			}
+		}
+
+		// the order itself serves as the queue
+		for (int head = 0; head < (int) order.size(); head++) {
+			int v = order[head];
+
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				if (--inDegree[csr->outTargets[a]] == 0) {
+					order.push_back(csr->outTargets[a]);
+				}
+			}
+		}
+	}
+
+	virtual ~TopologicalSort()
+	{
+		delete csr;
+	}
+
+	/**
+	 * Returns whether the graph is acyclic.
+	 *
+	 * @return <code>true</code> if a topological order exists.
+	 */
+	bool isAcyclic()
+	{
+		return (int) order.size() == csr->vertexCount;
+	}
+
+	/**
+	 * Returns the vertices in topological order.
+	 *
+	 * @return list of all vertices, or <code>NULL</code> if the graph is
+	 * cyclic.
+	 */
+	list<V*>* getOrder()
+	{
+		if (!isAcyclic()) {
+			return NULL;
+		}
+
+		list<V*>* vertices = new list<V*>();
+
+		for (int i = 0; i < (int) order.size(); i++) {
+			vertices->push_back(csr->vertices[order[i]]);
+		}
+
+		return vertices;
+	}
+};
+
+#endif /* TOPOLOGICALSORT_H_ */
@@ -0,0 +1,581 @@
+#ifndef TRIANGLECOUNTING_H_
+#define TRIANGLECOUNTING_H_
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <vector>
+#include <AbstractBaseGraph.h>
+#include <CSRGraph.h>
+#include <Graph.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Counts the triangles of an undirected graph, globally and per vertex, and
+ * derives the clustering coefficients from them. Directed graphs are
+ * treated as their underlying undirected graph. Parallel edges count once
+ * and self-loops not at all.
+ *
+ * <p>The neighbourhoods are kept as arrays sorted by vertex id. Graphs
+ * backed by an undirected {@link AbstractBaseGraph} convert the edge sets of
+ * their vertices directly (see <code>UndirectedSpecifics
+ * ::getSortedAdjacency</code>), all others go through a {@link CSRGraph}
+ * snapshot.</p>
+ *
+ * <p>Every edge is oriented from the endpoint of lower degree to the other
+ * one, with ties broken by id, which leaves every vertex at most <code>
+ * O(sqrt(m))</code> successors. Every triangle is then found exactly once,
+ * at its lowest vertex <code>v</code>, by intersecting the successors of
+ * <code>v</code> with those of each successor <code>u</code>, in <code>
+ * O(m^1.5)</code> overall. An intersection merges both arrays in blocks of
+ * four, compared all against all with SSE2 where available, unless one array
+ * is more than <code>GALLOP_RATIO</code> times longer than the other; then
+ * every element of the shorter one is searched in the longer one by
+ * galloping.</p>
+ *
+ * <p>The vertices run in parallel when compiled with OpenMP, scheduled
+ * dynamically since their work is skewed by degree. Every thread counts the
+ * triangles per vertex on its own and the counts are summed up at the
+ * end.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class TriangleCounting
+{
+public:
+	/**
+	 * Length ratio beyond which intersections gallop instead of merging.
+	 */
+	static const int GALLOP_RATIO = 32;
+
+	Graph<V, E>* graph;
+	int vertexCount;
+
+	/**
+	 * The vertices by id, in the order of the vertex set.
+	 */
+	vector<V*> vertices;
+
+	/**
+	 * The distinct neighbours of every vertex, sorted by id, in the range
+	 * <code>[offsets[v], offsets[v + 1])</code> of <code>neighbors</code>.
+	 */
+	vector<int> offsets;
+	vector<int> neighbors;
+
+	/**
+	 * Number of triangles of every vertex by id.
+	 */
+	vector<long> triangles;
+
+	long triangleCount;
+
+	/**
+	 * Prepares counting the triangles of the specified graph.
+	 *
+	 * @param g the graph
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>.
+	 */
+	TriangleCounting(Graph<V, E>* g)
+	{
+		if (g == NULL) {
+			throw new invalid_argument("NULL-pointer given for g");
+		}
+
+		graph = g;
+		calculated = false;
+
+		AbstractBaseGraph<V, E>* abg = dynamic_cast<AbstractBaseGraph<V, E>*>(g);
+		typename AbstractBaseGraph<V, E>::UndirectedSpecifics* specifics = NULL;
+
+		if (abg != NULL) {
+			specifics = dynamic_cast<typename AbstractBaseGraph<V, E>::UndirectedSpecifics*>(abg->specifics);
+		}
+
+		if (specifics != NULL) {
+			specifics->getSortedAdjacency(vertices, offsets, neighbors);
+			vertexCount = vertices.size();
+		} else {
+			CSRGraph<V, E> csr(g, false, false);
+			init(&csr);
+		}
+	}
+
+	/**
+	 * Prepares counting the triangles of the graph of the specified
+	 * snapshot, whose arcs are treated as undirected.
+	 *
+	 * @param csr the snapshot, which is only read here
+	 *
+	 * @throws invalid_argument if the snapshot is <code>NULL</code>.
+	 */
+	TriangleCounting(CSRGraph<V, E>* csr)
+	{
+		if (csr == NULL) {
+			throw new invalid_argument("NULL-pointer given for csr");
+		}
+
+		graph = csr->graph;
+		calculated = false;
+		init(csr);
+	}
+
+	virtual ~TriangleCounting()
+	{
+	}
+
+	/**
+	 * Counts the triangles.
+	 */
+	void run()
+	{
+		int n = vertexCount;
+		vector<int> upOffsets;
+		vector<int> up;
+
+		orient(upOffsets, up);
+
+		triangles.assign(n, 0);
+		long total = 0;
+		const int* base = up.empty() ? NULL : &up[0];
+
+		#pragma omp parallel
+		{
+			vector<long> local(n, 0);
+			vector<int> common;
+
+			#pragma omp for schedule(dynamic, 64) reduction(+:total) nowait
+			for (int v = 0; v < n; v++) {
+				const int* a = base + upOffsets[v];
+				int na = upOffsets[v + 1] - upOffsets[v];
+
+				if (na < 2) {
+					continue;
+				}
+
+				common.resize(na);
+
+				for (int i = 0; i < na; i++) {
+					int u = a[i];
+					const int* b = base + upOffsets[u];
+					int nb = upOffsets[u + 1] - upOffsets[u];
+					int c = intersect(a, na, b, nb, &common[0]);
+
+					local[v] += c;
+					local[u] += c;
+
+					for (int k = 0; k < c; k++) {
+						local[common[k]]++;
+					}
+
+					total += c;
+				}
+			}
+
+			#pragma omp critical
+			{
+				for (int v = 0; v < n; v++) {
+					triangles[v] += local[v];
+				}
+			}
+		}
+
+		triangleCount = total;
+		calculated = true;
+	}
+
+	/**
+	 * Returns the number of triangles of the graph.
+	 *
+	 * @return number of triangles
+	 *
+	 * @throws logic_error if the triangles were not counted yet.
+	 */
+	long getTriangleCount()
+	{
+		checkCalculated();
+
+		return triangleCount;
+	}
+
+	/**
+	 * Returns the number of triangles the specified vertex belongs to.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return number of triangles of the vertex
+	 *
+	 * @throws logic_error if the triangles were not counted yet.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	long getVertexTriangleCount(V* vertex)
+	{
+		checkCalculated();
+
+		return triangles[indexOf(vertex)];
+	}
+
+	/**
+	 * Returns the number of triangles of every vertex.
+	 *
+	 * @return map from the vertices to their number of triangles
+	 *
+	 * @throws logic_error if the triangles were not counted yet.
+	 */
+	map<V*, long>* getVertexTriangleCounts()
+	{
+		checkCalculated();
+
+		map<V*, long>* counts = new map<V*, long>();
+
+		for (int v = 0; v < vertexCount; v++) {
+			(*counts)[vertices[v]] = triangles[v];
+		}
+
+		return counts;
+	}
+
+	/**
+	 * Returns the local clustering coefficient of the specified vertex: the
+	 * fraction of pairs of its neighbours which are adjacent, or <code>0
+	 * </code> if it has less than two neighbours.
+	 *
+	 * @param vertex the vertex
+	 *
+	 * @return clustering coefficient of the vertex
+	 *
+	 * @throws logic_error if the triangles were not counted yet.
+	 * @throws invalid_argument if the vertex is not found in the graph.
+	 */
+	double getLocalClusteringCoefficient(V* vertex)
+	{
+		checkCalculated();
+
+		return localCoefficient(indexOf(vertex));
+	}
+
+	/**
+	 * Returns the local clustering coefficients of all vertices.
+	 *
+	 * @return map from the vertices to their clustering coefficient
+	 *
+	 * @throws logic_error if the triangles were not counted yet.
+	 */
+	map<V*, double>* getLocalClusteringCoefficients()
+	{
+		checkCalculated();
+
+		map<V*, double>* coefficients = new map<V*, double>();
+
+		for (int v = 0; v < vertexCount; v++) {
+			(*coefficients)[vertices[v]] = localCoefficient(v);
+		}
+
+		return coefficients;
+	}
+
+	/**
+	 * Returns the average of the local clustering coefficients over all
+	 * vertices, counting those with less than two neighbours as <code>0
+	 * </code>.
+	 *
+	 * @return average clustering coefficient, <code>0</code> for the empty
+	 * graph
+	 *
+	 * @throws logic_error if the triangles were not counted yet.
+	 */
+	double getAverageClusteringCoefficient()
+	{
+		checkCalculated();
+
+		if (vertexCount == 0) {
+			return 0.0;
+		}
+
+		double sum = 0.0;
+
+		for (int v = 0; v < vertexCount; v++) {
+			sum += localCoefficient(v);
+		}
+
+		return sum / vertexCount;
+	}
+
+	/**
+	 * Returns the global clustering coefficient (transitivity): three times
+	 * the number of triangles divided by the number of paths of length two.
+	 *
+	 * @return global clustering coefficient, <code>0</code> without paths of
+	 * length two
+	 *
+	 * @throws logic_error if the triangles were not counted yet.
+	 */
+	double getGlobalClusteringCoefficient()
+	{
+		checkCalculated();
+
+		double paths = 0.0;
+
+		for (int v = 0; v < vertexCount; v++) {
+			double d = degreeOf(v);
+
+			paths += d * (d - 1.0) / 2.0;
+		}
+
+		return paths > 0.0 ? 3.0 * triangleCount / paths : 0.0;
+	}
+
+	/**
+	 * Intersects two arrays of distinct ids sorted in ascending order,
+	 * galloping through the longer one if it is more than <code>
+	 * GALLOP_RATIO</code> times longer and merging otherwise.
+	 *
+	 * @param a first array
+	 * @param na length of the first array
+	 * @param b second array
+	 * @param nb length of the second array
+	 * @param out receives the common ids in ascending order, room for
+	 * <code>min(na, nb)</code> ids
+	 *
+	 * @return number of common ids
+	 */
+	static int intersect(const int* a, int na, const int* b, int nb, int* out)
+	{
+		if (na == 0 || nb == 0) {
+			return 0;
+		}
+		if (na > nb * GALLOP_RATIO) {
+			return gallop(b, nb, a, na, out);
+		}
+		if (nb > na * GALLOP_RATIO) {
+			return gallop(a, na, b, nb, out);
+		}
+
+		return merge(a, na, b, nb, out);
+	}
+
+	/**
+	 * Intersects two sorted arrays of distinct ids by merging them. With
+	 * SSE2, blocks of four ids of both arrays are compared all against all
+	 * by rotating one of them three times, and the block with the smaller
+	 * maximum moves on; the rest is merged one by one.
+	 *
+	 * @see #intersect
+	 */
+	static int merge(const int* a, int na, const int* b, int nb, int* out)
+	{
+		int i = 0;
+		int j = 0;
+		int count = 0;
+
+#ifdef __SSE2__
+		int blocksA = na & ~3;
+		int blocksB = nb & ~3;
+
+		while (i < blocksA && j < blocksB) {
+			__m128i va = _mm_loadu_si128((const __m128i*) (a + i));
+			__m128i vb = _mm_loadu_si128((const __m128i*) (b + j));
+			__m128i eq = _mm_cmpeq_epi32(va, vb);
+
+			eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+			eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+			eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+
+			int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+
+			while (mask != 0) {
+				out[count++] = a[i + __builtin_ctz(mask)];
+				mask &= mask - 1;
+			}
+
+			int maxA = a[i + 3];
+			int maxB = b[j + 3];
+
+			if (maxA <= maxB) {
+				i += 4;
+			}
+			if (maxB <= maxA) {
+				j += 4;
+			}
+		}
+#endif
+
+		while (i < na && j < nb) {
+			if (a[i] < b[j]) {
+				i++;
+			} else if (a[i] > b[j]) {
+				j++;
+			} else {
+				out[count++] = a[i];
+				i++;
+				j++;
+			}
+		}
+
+		return count;
+	}
+
+	/**
+	 * Intersects a short sorted array of distinct ids with a long one by
+	 * searching every id of the short one in the rest of the long one, with
+	 * exponentially growing steps followed by a binary search.
+	 *
+	 * @see #intersect
+	 */
+	static int gallop(const int* small, int ns, const int* large, int nl, int* out)
+	{
+		int count = 0;
+		int low = 0;
+
+		for (int i = 0; i < ns && low < nl; i++) {
+			int x = small[i];
+			int step = 1;
+			int high = low;
+
+			while (high < nl && large[high] < x) {
+				low = high + 1;
+				high += step;
+				step *= 2;
+			}
+
+			low = lower_bound(large + low, large + min(high, nl), x) - large;
+
+			if (low < nl && large[low] == x) {
+				out[count++] = x;
+				low++;
+			}
+		}
+
+		return count;
+	}
+
+private:
+	bool calculated;
+
+	void checkCalculated()
+	{
+		if (!calculated) {
+			throw new logic_error("Triangles have not been counted");
+		}
+	}
+
+	int indexOf(V* vertex)
+	{
+		typename vector<V*>::iterator it = lower_bound(vertices.begin(), vertices.end(), vertex);
+
+		if (it == vertices.end() || *it != vertex) {
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		return it - vertices.begin();
+	}
+
+	int degreeOf(int v)
+	{
+		return offsets[v + 1] - offsets[v];
+	}
+
+	double localCoefficient(int v)
+	{
+		double d = degreeOf(v);
+
+		return d < 2.0 ? 0.0 : 2.0 * triangles[v] / (d * (d - 1.0));
+	}
+
+	/**
+	 * Copies the arcs of the snapshot as sorted neighbourhoods without
+	 * duplicates and self-loops. The vertices of a snapshot are ordered like
+	 * its vertex set, by address.
+	 */
+	void init(CSRGraph<V, E>* csr)
+	{
+		vertexCount = csr->vertexCount;
+		vertices = csr->vertices;
+
+		// an arc of a directed snapshot is only listed at its tail, so both
+		// rows receive it
+		vector<int> degree(vertexCount, 0);
+
+		for (int v = 0; v < vertexCount; v++) {
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				degree[v]++;
+				if (csr->directed) {
+					degree[csr->outTargets[a]]++;
+				}
+			}
+		}
+
+		vector<int> next(vertexCount + 1, 0);
+
+		for (int v = 0; v < vertexCount; v++) {
+			next[v + 1] = next[v] + degree[v];
+		}
+
+		vector<int> all(next[vertexCount]);
+
+		for (int v = 0; v < vertexCount; v++) {
+			for (int a = csr->outOffsets[v]; a < csr->outOffsets[v + 1]; a++) {
+				int w = csr->outTargets[a];
+
+				all[next[v]++] = w;
+				if (csr->directed) {
+					all[next[w]++] = v;
+				}
+			}
+		}
+
+		offsets.assign(1, 0);
+		neighbors.clear();
+		neighbors.reserve(all.size());
+
+		int start = 0;
+
+		for (int v = 0; v < vertexCount; v++) {
+			int end = start + degree[v];
+			int row = neighbors.size();
+
+			for (int i = start; i < end; i++) {
+				if (all[i] != v) {
+					neighbors.push_back(all[i]);
+				}
+			}
+
+			sort(neighbors.begin() + row, neighbors.end());
+			neighbors.erase(unique(neighbors.begin() + row, neighbors.end()), neighbors.end());
+			offsets.push_back(neighbors.size());
+			start = end;
+		}
+	}
+
+	/**
+	 * Keeps of every neighbourhood the neighbours of higher degree, or of
+	 * equal degree and higher id, which stay sorted by id.
+	 */
+	void orient(vector<int>& upOffsets, vector<int>& up)
+	{
+		upOffsets.assign(vertexCount + 1, 0);
+		up.reserve(neighbors.size() / 2);
+
+		for (int v = 0; v < vertexCount; v++) {
+			int dv = degreeOf(v);
+
+			for (int i = offsets[v]; i < offsets[v + 1]; i++) {
+				int u = neighbors[i];
+				int du = degreeOf(u);
+
+				if (du > dv || (du == dv && u > v)) {
+					up.push_back(u);
+				}
+			}
+
+			upOffsets[v + 1] = up.size();
+		}
+	}
+};
+
+#endif /* TRIANGLECOUNTING_H_ */
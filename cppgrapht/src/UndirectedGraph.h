@@ -15,7 +15,7 @@
  * @since 2011-06-03
  */
 template <class V, class E>
-class UndirectedGraph : public Graph<V, E>
+class UndirectedGraph : public virtual Graph<V, E>
 {
 public:
 	/**
@@ -10,7 +10,7 @@
  * @since 2011-06-03
  */
 template <class V, class E>
-class WeightedGraph : public Graph<V, E>
+class WeightedGraph : public virtual Graph<V, E>
 {
 public:
 	/**
@@ -0,0 +1,381 @@
+#ifndef YENSHORTESTPATHITERATOR_H_
+#define YENSHORTESTPATHITERATOR_H_
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <CSRGraph.h>
+#include <CSRSearch.h>
+#include <Graph.h>
+#include <GraphPath.h>
+#include <GraphPathImpl.h>
+
+/**
+ * Iterates over the simple (loopless) paths between two vertices in order of
+ * increasing weight, by the algorithm of Yen ("Finding the K Shortest
+ * Loopless Paths in a Network", 1971). The paths are generated lazily: every
+ * call of {@link #next} only searches the deviations of the path returned
+ * before. Edge weights must be non-negative; undirected edges may be
+ * traversed either way.
+ *
+ * <p>Every deviation of a path keeps a prefix of it up to a spur vertex and
+ * continues with a shortest path from there which avoids the vertices of the
+ * prefix and the edges by which the paths found so far with the same prefix
+ * leave the spur vertex. Following Lawler, a path is only deviated from the
+ * vertex at which it deviated from its parent on. The masked vertices and
+ * edges are set in temporary bitsets which the {@link CSRSearch} skips; the
+ * graph and its snapshot are never changed.</p>
+ *
+ * <p>All deviation searches share the shortest path tree towards the target,
+ * computed once by a backward search. Its distances are a consistent lower
+ * bound for every masked search, which thus runs as A* and settles hardly
+ * more than the vertices of the path it finds. If the tree path from the spur
+ * vertex avoids the masked vertices and edges, it is the shortest deviation
+ * itself and no search runs at all.</p>
+ *
+ * <p>Paths of equal weight are returned in an arbitrary but deterministic
+ * order.</p>
+ *
+ * @since 2026-10-18
+ */
+template <class V, class E>
+class YenShortestPathIterator
+{
+public:
+	Graph<V, E>* graph;
+	CSRGraph<V, E>* csr;
+	int source;
+	int target;
+
+	/**
+	 * Distance of every vertex to the target, and the next vertex and edge
+	 * on a shortest path to it, or <code>-1</code> at the target and at
+	 * vertices which cannot reach it.
+	 */
+	vector<double> toTarget;
+	vector<int> treeNext;
+	vector<int> treeEdge;
+
+	/**
+	 * Number of deviations taken from the shortest path tree and found by a
+	 * search, respectively.
+	 */
+	int shortcutCount;
+	int searchCount;
+
+	/**
+	 * Prepares the iteration over the paths between the specified vertices.
+	 *
+	 * @param g the graph
+	 * @param sourceVertex first vertex of the paths
+	 * @param targetVertex last vertex of the paths
+	 *
+	 * @throws invalid_argument if the graph is <code>NULL</code>, a vertex
+	 * is not found in the graph or an edge weight is negative.
+	 */
+	YenShortestPathIterator(Graph<V, E>* g, V* sourceVertex, V* targetVertex)
+	{
+		graph = g;
+		csr = new CSRGraph<V, E>(g, true);
+
+		if (csr->hasNegativeEdgeWeight()) {
+			delete csr;
+			throw new invalid_argument("Edge weights must not be negative");
+		}
+
+		source = csr->indexOf(sourceVertex);
+		target = csr->indexOf(targetVertex);
+
+		if (source < 0 || target < 0) {
+			delete csr;
+			throw new invalid_argument("No such vertex in graph");
+		}
+
+		search = new CSRSearch<V, E>(csr);
+		buildTree();
+
+		vertexMask.assign(csr->vertexCount / CSRSearch<V, E>::MASK_BITS + 1, 0UL);
+		edgeMask.assign(csr->edgeCount / CSRSearch<V, E>::MASK_BITS + 1, 0UL);
+
+		search->vertexMask = &vertexMask;
+		search->edgeMask = &edgeMask;
+
+		started = false;
+		expanded = true;
+		shortcutCount = 0;
+		searchCount = 0;
+	}
+
+	virtual ~YenShortestPathIterator()
+	{
+		delete search;
+		delete csr;
+	}
+
+	/**
+	 * Returns whether there is another path, which searches the deviations
+	 * of the last path returned if that was not done yet.
+	 *
+	 * @return <code>true</code> if {@link #next} returns another path.
+	 */
+	bool hasNext()
+	{
+		prepare();
+
+		return !candidates.empty();
+	}
+
+	/**
+	 * Returns the next shortest path.
+	 *
+	 * @return the path, owned by the caller
+	 *
+	 * @throws logic_error if there is no further path.
+	 */
+	GraphPath<V, E>* next()
+	{
+		prepare();
+
+		if (candidates.empty()) {
+			throw new logic_error("No further path");
+		}
+
+		found.push_back(*candidates.begin());
+		candidates.erase(candidates.begin());
+		expanded = false;
+
+		const Path& path = found.back();
+		list<E*>* edgeList = new list<E*>();
+
+		for (int i = 0; i < (int) path.edges.size(); i++) {
+			edgeList->push_back(csr->edges[path.edges[i]]);
+		}
+
+		return new GraphPathImpl<V, E>(
+			graph,
+			csr->vertices[source],
+			csr->vertices[target],
+			edgeList,
+			path.weight);
+	}
+
+	/**
+	 * Returns the number of paths returned so far.
+	 *
+	 * @return number of paths
+	 */
+	int getPathCount()
+	{
+		return found.size();
+	}
+
+private:
+	/**
+	 * A path by its edge ids, with the index of the edge at which it
+	 * deviates from its parent. Paths are ordered by weight and then by
+	 * their edges.
+	 */
+	struct Path
+	{
+		double weight;
+		vector<int> edges;
+		int deviation;
+
+		bool operator<(const Path& other) const
+		{
+			if (weight != other.weight) {
+				return weight < other.weight;
+			}
+
+			return edges < other.edges;
+		}
+	};
+
+	/**
+	 * The distances of the shortest path tree as heuristic of the
+	 * deviation searches.
+	 */
+	struct TreeHeuristic
+	{
+		const vector<double>* toTarget;
+
+		double operator()(int vertex, int) const
+		{
+			return (*toTarget)[vertex];
+		}
+	};
+
+	CSRSearch<V, E>* search;
+	vector<unsigned long> vertexMask;
+	vector<unsigned long> edgeMask;
+
+	vector<Path> found;
+	set<Path> candidates;
+	bool started;
+	bool expanded;
+
+	void buildTree()
+	{
+		int n = csr->vertexCount;
+
+		search->runAll(target, true);
+
+		toTarget.resize(n);
+		treeNext.assign(n, -1);
+		treeEdge.assign(n, -1);
+
+		for (int v = 0; v < n; v++) {
+			toTarget[v] = search->getDistance(v);
+
+			if (v != target && search->isReached(v)) {
+				treeNext[v] = search->predecessor[v];
+				treeEdge[v] = search->predecessorEdge[v];
+			}
+		}
+	}
+
+	void prepare()
+	{
+		if (!started) {
+			started = true;
+
+			if (toTarget[source] < numeric_limits<double>::infinity()) {
+				Path first;
+
+				first.deviation = 0;
+				first.weight = treePath(source, first.edges);
+				candidates.insert(first);
+			}
+		} else if (!expanded) {
+			expanded = true;
+			deviate(found.back());
+		}
+	}
+
+	static void setBit(vector<unsigned long>& mask, int id, bool value)
+	{
+		unsigned long bit = 1UL << (id % CSRSearch<V, E>::MASK_BITS);
+
+		if (value) {
+			mask[id / CSRSearch<V, E>::MASK_BITS] |= bit;
+		} else {
+			mask[id / CSRSearch<V, E>::MASK_BITS] &= ~bit;
+		}
+	}
+
+	/**
+	 * Appends the edges of the tree path from the vertex to the target and
+	 * returns its weight, or infinity, appending nothing, if the path runs
+	 * through a masked vertex or edge.
+	 */
+	double treePath(int v, vector<int>& edges)
+	{
+		int start = edges.size();
+		double weight = 0.0;
+
+		while (v != target) {
+			int e = treeEdge[v];
+			int w = treeNext[v];
+
+			if (CSRSearch<V, E>::isMasked(edgeMask, e) || CSRSearch<V, E>::isMasked(vertexMask, w)) {
+				edges.resize(start);
+
+				return numeric_limits<double>::infinity();
+			}
+
+			edges.push_back(e);
+			weight += csr->edgeWeights[e];
+			v = w;
+		}
+
+		return weight;
+	}
+
+	/**
+	 * Adds the deviations of the path from its deviation index on to the
+	 * candidates.
+	 */
+	void deviate(const Path& path)
+	{
+		int k = path.edges.size();
+		vector<int> vertices(k + 1);
+		double rootWeight = 0.0;
+
+		vertices[0] = source;
+		for (int i = 0; i < k; i++) {
+			int e = path.edges[i];
+
+			vertices[i + 1] = csr->edgeSources[e] == vertices[i] ? csr->edgeTargets[e] : csr->edgeSources[e];
+		}
+
+		for (int i = 0; i < path.deviation; i++) {
+			setBit(vertexMask, vertices[i], true);
+			rootWeight += csr->edgeWeights[path.edges[i]];
+		}
+
+		TreeHeuristic heuristic;
+		heuristic.toTarget = &toTarget;
+
+		vector<int> masked;
+
+		for (int i = path.deviation; i < k; i++) {
+			int spur = vertices[i];
+
+			// the edges leaving the spur vertex on paths with the same root
+			for (int p = 0; p < (int) found.size(); p++) {
+				const vector<int>& other = found[p].edges;
+
+				if ((int) other.size() > i && equal(other.begin(), other.begin() + i, path.edges.begin())) {
+					setBit(edgeMask, other[i], true);
+					masked.push_back(other[i]);
+				}
+			}
+
+			Path candidate;
+
+			candidate.deviation = i;
+			candidate.edges.assign(path.edges.begin(), path.edges.begin() + i);
+
+			double spurWeight = treePath(spur, candidate.edges);
+
+			if (spurWeight < numeric_limits<double>::infinity()) {
+				shortcutCount++;
+			} else if (toTarget[spur] < numeric_limits<double>::infinity()) {
+				searchCount++;
+
+				if (search->run(spur, target, heuristic)) {
+					int start = candidate.edges.size();
+
+					for (int v = target; v != spur; v = search->predecessor[v]) {
+						candidate.edges.push_back(search->predecessorEdge[v]);
+					}
+
+					reverse(candidate.edges.begin() + start, candidate.edges.end());
+					spurWeight = search->distance[target];
+				}
+			}
+
+			if (spurWeight < numeric_limits<double>::infinity()) {
+				candidate.weight = rootWeight + spurWeight;
+				candidates.insert(candidate);
+			}
+
+			for (int j = 0; j < (int) masked.size(); j++) {
+				setBit(edgeMask, masked[j], false);
+			}
+
+			masked.clear();
+			setBit(vertexMask, spur, true);
+			rootWeight += csr->edgeWeights[path.edges[i]];
+		}
+
+		for (int i = 0; i < k; i++) {
+			setBit(vertexMask, vertices[i], false);
+		}
+	}
+};
+
+#endif /* YENSHORTESTPATHITERATOR_H_ */